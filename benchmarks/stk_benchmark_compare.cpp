@@ -0,0 +1,108 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+//! stk_benchmark_compare <baseline.json> <current.json> [--threshold <fraction>] [--noise <MADs>]
+//!
+//! Compares the medians of the benchmarks in two stk_benchmarks --json outputs. A benchmark regresses when its median grows by more than
+//! threshold (default 0.05) of the baseline and by more than noise (default 3) times the summed MADs of the two runs. Exits with 1 when
+//! any benchmark regressed.
+
+#include <stk/utility/benchmark.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+
+namespace {
+
+    std::map<std::string, stk::benchmark_statistics> read_benchmarks(const std::string& path)
+    {
+        boost::property_tree::ptree tree;
+        boost::property_tree::read_json(path, tree);
+        std::map<std::string, stk::benchmark_statistics> results;
+        for (const auto& item : tree.get_child("benchmarks")) {
+            const auto& b = item.second;
+            stk::benchmark_statistics s;
+            s.median = b.get<double>("median_ns");
+            s.mad = b.get<double>("mad_ns");
+            s.p10 = b.get<double>("p10_ns", 0.0);
+            s.p90 = b.get<double>("p90_ns", 0.0);
+            s.p99 = b.get<double>("p99_ns", 0.0);
+            s.min = b.get<double>("min_ns", 0.0);
+            s.max = b.get<double>("max_ns", 0.0);
+            results[b.get<std::string>("name")] = s;
+        }
+        return results;
+    }
+
+}//! namespace;
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3) {
+        std::cerr << "usage: stk_benchmark_compare <baseline.json> <current.json> [--threshold <fraction>] [--noise <MADs>]\n";
+        return 2;
+    }
+
+    double threshold = 0.05;
+    double noise = 3.0;
+    for (int i = 3; i + 1 < argc; i += 2) {
+        auto arg = std::string(argv[i]);
+        if (arg == "--threshold")
+            threshold = std::strtod(argv[i + 1], nullptr);
+        else if (arg == "--noise")
+            noise = std::strtod(argv[i + 1], nullptr);
+    }
+
+    std::map<std::string, stk::benchmark_statistics> baseline, current;
+    try {
+        baseline = read_benchmarks(argv[1]);
+        current = read_benchmarks(argv[2]);
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 2;
+    }
+
+    std::size_t regressions = 0;
+    for (const auto& item : current) {
+        auto it = baseline.find(item.first);
+        if (it == baseline.end()) {
+            std::cout << std::left << std::setw(56) << item.first << " new\n";
+            continue;
+        }
+
+        const auto& b = it->second;
+        const auto& c = item.second;
+        auto verdict = stk::compare_benchmark(b, c, threshold, noise);
+        auto change = b.median > 0 ? 100.0 * (c.median - b.median) / b.median : 0.0;
+        std::cout << std::left << std::setw(56) << item.first << std::right << std::setw(12) << b.median << " -> " << std::setw(12) << c.median << " ns/op "
+                  << std::showpos << std::fixed << std::setprecision(1) << change << "%" << std::noshowpos << std::defaultfloat << std::setprecision(6);
+        if (verdict == stk::benchmark_verdict::regressed) {
+            std::cout << "  REGRESSED";
+            ++regressions;
+        }
+        else if (verdict == stk::benchmark_verdict::improved)
+            std::cout << "  improved";
+        std::cout << "\n";
+    }
+
+    for (const auto& item : baseline)
+        if (current.find(item.first) == current.end())
+            std::cout << std::left << std::setw(56) << item.first << " missing\n";
+
+    if (regressions) {
+        std::cout << regressions << " benchmark(s) regressed.\n";
+        return 1;
+    }
+
+    return 0;
+}
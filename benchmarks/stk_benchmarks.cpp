@@ -0,0 +1,430 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+//! stk_benchmarks [--json <file>] [--filter <substring>] [--repetitions <n>] [--warmup <n>]
+//!
+//! Runs the STK benchmark suite and prints the median, MAD and percentiles of the time per operation along with the hardware counters
+//! (when available.) The results are written as JSON with --json for comparison with stk_benchmark_compare.
+
+#include <stk/utility/benchmark.hpp>
+#include <stk/thread/work_stealing_thread_pool.hpp>
+#include <stk/thread/concurrentqueue.h>
+#include <stk/thread/concurrentqueue_queue_info_no_tokens.h>
+#include <stk/thread/vyukov_mpmc_queue.hpp>
+#include <stk/container/locked_queue.hpp>
+#include <stk/container/concurrent_numeric_unordered_map.hpp>
+#include <stk/container/concurrent_hash_grid.hpp>
+#include <stk/container/string_interner.hpp>
+#include <stk/geometry/geometry_kernel.hpp>
+#include <stk/geometry/clipper_boolean_operations.hpp>
+#include <stk/geometry/space_partition/rtree_triangle_cache.ipp>
+#include <stk/math/math.hpp>
+#include <stk/math/exp_batch.hpp>
+#include <stk/random/philox4x32_generator.hpp>
+#include <stk/random/xoroshiro128plus_generator.hpp>
+#include <stk/random/xorshift1024starphi_generator.hpp>
+#include <stk/utility/fast_hash.hpp>
+#include <stk/utility/string_hash.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using mc_queue_traits = moodycamel_concurrent_queue_traits_no_tokens;
+
+namespace {
+
+    //! Keeps a value alive so the optimizer cannot remove the computation producing it.
+    template <typename T>
+    inline void do_not_optimize(const T& v)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "g"(&v) : "memory");
+#else
+        static const volatile void* sink;
+        sink = &v;
+#endif
+    }
+
+    struct benchmark_case
+    {
+        std::string                                                         name;
+        std::function<stk::benchmark_result(const stk::benchmark_options&)> run;
+    };
+
+    using pool_type = stk::thread::work_stealing_thread_pool<mc_queue_traits>;
+
+    void add_thread_pool_benchmarks(std::vector<benchmark_case>& cases, pool_type& pool)
+    {
+        cases.push_back({ "work_stealing_thread_pool/parallel_apply", [&pool](const stk::benchmark_options& o)
+        {
+            const std::size_t n = 100000;
+            std::vector<std::uint64_t> v(n);
+            return stk::run_benchmark("work_stealing_thread_pool/parallel_apply", n, [&]()
+            {
+                pool.parallel_apply(static_cast<std::ptrdiff_t>(n), [&v](std::ptrdiff_t i) { v[i] += static_cast<std::uint64_t>(i); });
+            }, o);
+        } });
+
+        cases.push_back({ "work_stealing_thread_pool/send", [&pool](const stk::benchmark_options& o)
+        {
+            const std::size_t n = 20000;
+            using future_t = pool_type::future<void>;
+            std::vector<future_t> fs;
+            fs.reserve(n);
+            return stk::run_benchmark("work_stealing_thread_pool/send", n, [&]()
+            {
+                fs.clear();
+                for (std::size_t i = 0; i < n; ++i)
+                    fs.emplace_back(pool.send([]() -> void {}));
+                for (auto& f : fs)
+                    f.wait();
+            }, o);
+        } });
+    }
+
+    void add_queue_benchmarks(std::vector<benchmark_case>& cases)
+    {
+        const std::size_t n = 1 << 16;
+        cases.push_back({ "queue/moodycamel_concurrent_queue", [n](const stk::benchmark_options& o)
+        {
+            moodycamel::ConcurrentQueue<std::uint64_t> q;
+            return stk::run_benchmark("queue/moodycamel_concurrent_queue", n, [&]()
+            {
+                std::uint64_t v = 0;
+                for (std::uint64_t i = 0; i < n; ++i)
+                    q.enqueue(i);
+                while (q.try_dequeue(v))
+                    do_not_optimize(v);
+            }, o);
+        } });
+
+        cases.push_back({ "queue/vyukov_mpmc_bounded_queue", [n](const stk::benchmark_options& o)
+        {
+            stk::thread::vyukov_mpmc_bounded_queue<std::uint64_t> q(n);
+            return stk::run_benchmark("queue/vyukov_mpmc_bounded_queue", n, [&]()
+            {
+                std::uint64_t v = 0;
+                for (std::uint64_t i = 0; i < n; ++i)
+                    q.try_push(i);
+                while (q.try_pop(v))
+                    do_not_optimize(v);
+            }, o);
+        } });
+
+        cases.push_back({ "queue/locked_queue", [n](const stk::benchmark_options& o)
+        {
+            stk::locked_queue<std::uint64_t> q;
+            return stk::run_benchmark("queue/locked_queue", n, [&]()
+            {
+                std::uint64_t v = 0;
+                for (std::uint64_t i = 0; i < n; ++i)
+                    q.try_push(i);
+                while (q.try_pop(v))
+                    do_not_optimize(v);
+            }, o);
+        } });
+    }
+
+    void add_concurrent_map_benchmarks(std::vector<benchmark_case>& cases, pool_type& pool)
+    {
+        cases.push_back({ "concurrent_numeric_unordered_map/insert_find_erase", [&pool](const stk::benchmark_options& o)
+        {
+            const std::size_t n = 100000;
+            return stk::run_benchmark("concurrent_numeric_unordered_map/insert_find_erase", n, [&]()
+            {
+                stk::concurrent_numeric_unordered_map<std::uint64_t, int> m;
+                pool.parallel_apply(static_cast<std::ptrdiff_t>(n), [&m](std::ptrdiff_t i)
+                {
+                    auto k = static_cast<std::uint64_t>(i) + 1;
+                    m.insert(k, static_cast<int>(i));
+                    do_not_optimize(m.find(k));
+                    m.erase(k);
+                });
+            }, o);
+        } });
+    }
+
+    void add_hash_grid_benchmarks(std::vector<benchmark_case>& cases, pool_type& pool)
+    {
+        struct cell
+        {
+            std::atomic<std::uint32_t> hits{ 0 };
+        };
+
+        cases.push_back({ "concurrent_hash_grid_2d/get_cell", [&pool](const stk::benchmark_options& o)
+        {
+            const std::uint32_t extent = 20000;
+            const std::size_t n = 200000;
+            std::vector<std::pair<std::uint32_t, std::uint32_t>> cells;
+            stk::xorshift1024starphi_generator gen;
+            for (std::size_t i = 0; i < n; ++i)
+                cells.emplace_back(static_cast<std::uint32_t>(gen() % extent), static_cast<std::uint32_t>(gen() % extent));
+
+            geometrix::grid_traits<double> traits(0.0, extent, 0.0, extent, 3.0);
+            stk::concurrent_hash_grid_2d<cell, geometrix::grid_traits<double>> grid(traits);
+            return stk::run_benchmark("concurrent_hash_grid_2d/get_cell", n, [&]()
+            {
+                pool.parallel_apply(static_cast<std::ptrdiff_t>(n), [&](std::ptrdiff_t i)
+                {
+                    grid.get_cell(cells[i].first, cells[i].second).hits.fetch_add(1, std::memory_order_relaxed);
+                });
+            }, o);
+        } });
+    }
+
+    void add_geometry_benchmarks(std::vector<benchmark_case>& cases)
+    {
+        using namespace stk;
+        using boost::units::si::meters;
+
+        cases.push_back({ "rtree_triangle_cache/find_indices", [](const benchmark_options& o)
+        {
+            //! A grid of 100 x 100 cells each split into two triangles.
+            const std::size_t cellsPerSide = 100;
+            std::vector<std::array<point2, 3>> trigs;
+            for (std::size_t i = 0; i < cellsPerSide; ++i) {
+                for (std::size_t j = 0; j < cellsPerSide; ++j) {
+                    auto x0 = static_cast<double>(i) * meters, x1 = static_cast<double>(i + 1) * meters;
+                    auto y0 = static_cast<double>(j) * meters, y1 = static_cast<double>(j + 1) * meters;
+                    trigs.push_back({ point2{ x0, y0 }, point2{ x1, y0 }, point2{ x1, y1 } });
+                    trigs.push_back({ point2{ x0, y0 }, point2{ x1, y1 }, point2{ x0, y1 } });
+                }
+            }
+            rtree_triangle_cache cache(trigs);
+
+            const std::size_t n = 100000;
+            std::vector<point2> queries;
+            philox4x32_generator gen(1, 0);
+            for (std::size_t i = 0; i < n; ++i)
+                queries.emplace_back(static_cast<double>(gen() % 10000) / 100.0 * meters, static_cast<double>(gen() % 10000) / 100.0 * meters);
+            return run_benchmark("rtree_triangle_cache/find_indices", n, [&]()
+            {
+                for (const auto& p : queries)
+                    do_not_optimize(cache.find_indices(p).size());
+            }, o);
+        } });
+
+        auto square = [](double x, double y, double size)
+        {
+            return polygon2{ { x * meters, y * meters }, { (x + size) * meters, y * meters }, { (x + size) * meters, (y + size) * meters }, { x * meters, (y + size) * meters } };
+        };
+
+        cases.push_back({ "clipper/union", [square](const benchmark_options& o)
+        {
+            //! Overlapping squares along a diagonal band.
+            std::vector<polygon2> pgons;
+            for (std::size_t i = 0; i < 200; ++i)
+                pgons.push_back(square(0.5 * static_cast<double>(i), 0.25 * static_cast<double>(i % 7), 1.0));
+            return run_benchmark("clipper/union", pgons.size(), [&]()
+            {
+                do_not_optimize(clipper_union(pgons, 1000).size());
+            }, o);
+        } });
+
+        cases.push_back({ "clipper/offset_difference", [square](const benchmark_options& o)
+        {
+            auto outer = square(-100.0, -100.0, 200.0);
+            std::vector<polygon2> holes;
+            for (std::size_t i = 0; i < 100; ++i)
+                holes.push_back(square(-90.0 + 17.0 * static_cast<double>(i % 10), -90.0 + 17.0 * static_cast<double>(i / 10), 10.0));
+            return run_benchmark("clipper/offset_difference", holes.size(), [&]()
+            {
+                std::vector<polygon_with_holes2> grown;
+                for (const auto& h : holes) {
+                    auto r = clipper_offset(h, 0.5 * meters, 1000);
+                    grown.insert(grown.end(), r.begin(), r.end());
+                }
+                do_not_optimize(clipper_difference(outer, grown, 1000).size());
+            }, o);
+        } });
+    }
+
+    void add_math_benchmarks(std::vector<benchmark_case>& cases)
+    {
+        const std::size_t n = 1 << 16;
+        auto inputs = [n]()
+        {
+            std::vector<double> x(n);
+            for (std::size_t i = 0; i < n; ++i)
+                x[i] = -10.0 + 20.0 * static_cast<double>(i) / static_cast<double>(n);
+            return x;
+        };
+
+        cases.push_back({ "math/stk_exp", [n, inputs](const stk::benchmark_options& o)
+        {
+            auto x = inputs();
+            return stk::run_benchmark("math/stk_exp", n, [&]()
+            {
+                double sum = 0;
+                for (auto v : x)
+                    sum += stk::exp(v);
+                do_not_optimize(sum);
+            }, o);
+        } });
+
+        cases.push_back({ "math/exp_batch", [n, inputs](const stk::benchmark_options& o)
+        {
+            auto x = inputs();
+            std::vector<double> y(n);
+            return stk::run_benchmark("math/exp_batch", n, [&]()
+            {
+                stk::exp_batch(stk::span<const double>(x), stk::span<double>(y));
+                do_not_optimize(y[n / 2]);
+            }, o);
+        } });
+
+        cases.push_back({ "math/stk_sin", [n, inputs](const stk::benchmark_options& o)
+        {
+            auto x = inputs();
+            return stk::run_benchmark("math/stk_sin", n, [&]()
+            {
+                double sum = 0;
+                for (auto v : x)
+                    sum += stk::sin(v);
+                do_not_optimize(sum);
+            }, o);
+        } });
+    }
+
+    template <typename Generator>
+    benchmark_case make_rng_benchmark(std::string name, Generator gen)
+    {
+        return { name, [name, gen](const stk::benchmark_options& o) mutable
+        {
+            const std::size_t n = 1 << 20;
+            return stk::run_benchmark(name, n, [&]()
+            {
+                std::uint64_t sum = 0;
+                for (std::size_t i = 0; i < n; ++i)
+                    sum += gen();
+                do_not_optimize(sum);
+            }, o);
+        } };
+    }
+
+    void add_rng_benchmarks(std::vector<benchmark_case>& cases)
+    {
+        cases.push_back(make_rng_benchmark("random/philox4x32_generator", stk::philox4x32_generator(42, 0)));
+        cases.push_back(make_rng_benchmark("random/xoroshiro128plus_generator", stk::xoroshiro128plus_generator()));
+        cases.push_back(make_rng_benchmark("random/xorshift1024starphi_generator", stk::xorshift1024starphi_generator()));
+    }
+
+    void add_string_benchmarks(std::vector<benchmark_case>& cases, pool_type& pool)
+    {
+        const std::size_t n = 1 << 16;
+        auto names = [n]()
+        {
+            std::vector<std::string> v(n);
+            for (std::size_t i = 0; i < n; ++i)
+                v[i] = "stk::thread::work_stealing_thread_pool/job_" + std::to_string(i);
+            return v;
+        };
+
+        cases.push_back({ "string/fnv1a_hash", [n, names](const stk::benchmark_options& o)
+        {
+            auto v = names();
+            return stk::run_benchmark("string/fnv1a_hash", n, [&]()
+            {
+                std::uint64_t sum = 0;
+                for (auto& s : v)
+                    sum += stk::fnv1a_hash<std::uint64_t>(s.c_str());
+                do_not_optimize(sum);
+            }, o);
+        } });
+
+        cases.push_back({ "string/fast_hash", [n, names](const stk::benchmark_options& o)
+        {
+            auto v = names();
+            return stk::run_benchmark("string/fast_hash", n, [&]()
+            {
+                std::uint64_t sum = 0;
+                for (auto& s : v)
+                    sum += stk::fast_hash(s);
+                do_not_optimize(sum);
+            }, o);
+        } });
+
+        cases.push_back({ "string/string_interner_find", [n, names, &pool](const stk::benchmark_options& o)
+        {
+            auto v = names();
+            stk::string_interner interner(n);
+            std::vector<stk::string_interner::id_type> ids;
+            interner.intern(v.begin(), v.end(), std::back_inserter(ids));
+            return stk::run_benchmark("string/string_interner_find", n, [&]()
+            {
+                pool.parallel_apply(static_cast<std::ptrdiff_t>(n), [&](std::ptrdiff_t i) { ids[i] = interner.find(v[i]); });
+                do_not_optimize(ids[n / 2]);
+            }, o);
+        } });
+    }
+
+}//! namespace;
+
+int main(int argc, char* argv[])
+{
+    std::string jsonPath;
+    std::string filter;
+    stk::benchmark_options options;
+    for (int i = 1; i < argc; ++i) {
+        auto arg = std::string(argv[i]);
+        auto hasValue = i + 1 < argc;
+        if (arg == "--json" && hasValue)
+            jsonPath = argv[++i];
+        else if (arg == "--filter" && hasValue)
+            filter = argv[++i];
+        else if (arg == "--repetitions" && hasValue)
+            options.repetitions = std::strtoul(argv[++i], nullptr, 10);
+        else if (arg == "--warmup" && hasValue)
+            options.warmup = std::strtoul(argv[++i], nullptr, 10);
+        else {
+            std::cerr << "usage: stk_benchmarks [--json <file>] [--filter <substring>] [--repetitions <n>] [--warmup <n>]\n";
+            return 2;
+        }
+    }
+
+    if (options.repetitions == 0) {
+        std::cerr << "--repetitions must be positive.\n";
+        return 2;
+    }
+
+    pool_type pool;
+    std::vector<benchmark_case> cases;
+    add_thread_pool_benchmarks(cases, pool);
+    add_queue_benchmarks(cases);
+    add_concurrent_map_benchmarks(cases, pool);
+    add_hash_grid_benchmarks(cases, pool);
+    add_geometry_benchmarks(cases);
+    add_math_benchmarks(cases);
+    add_rng_benchmarks(cases);
+    add_string_benchmarks(cases, pool);
+
+    std::vector<stk::benchmark_result> results;
+    for (auto& c : cases) {
+        if (!filter.empty() && c.name.find(filter) == std::string::npos)
+            continue;
+        results.push_back(c.run(options));
+        std::cout << results.back() << std::endl;
+    }
+
+    if (!jsonPath.empty()) {
+        std::ofstream os(jsonPath);
+        if (!os) {
+            std::cerr << "Failed to open " << jsonPath << ".\n";
+            return 1;
+        }
+        stk::write_json(os, results);
+    }
+
+    return 0;
+}
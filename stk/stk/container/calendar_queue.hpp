@@ -0,0 +1,209 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef STK_CONTAINER_CALENDAR_QUEUE_HPP
+#define STK_CONTAINER_CALENDAR_QUEUE_HPP
+#pragma once
+
+#include <geometrix/utility/assert.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <cstdint>
+#include <vector>
+
+namespace stk {
+
+    //! A calendar queue (R. Brown, 1988) is a priority queue keyed on time with O(1) amortized push and pop when the time increments
+    //! between events are reasonably distributed. Time is divided into a circular array of buckets (days) of fixed width; an event at
+    //! time t belongs to day floor(t / width) and to bucket day % number_buckets. Popping scans forward from the current day, taking the
+    //! smallest event of the bucket when it belongs to the day being scanned, and falls back to a direct search after a full year of empty days.
+    //! The number of buckets tracks the size of the queue and the width is re-estimated from the spacing of the earliest events on each resize.
+    //! Events with equal times are popped in the order they were pushed.
+    template <typename T, typename Time = double>
+    class calendar_queue
+    {
+    public:
+
+        using value_type = T;
+        using time_type = Time;
+
+        struct entry
+        {
+            Time          time;
+            std::uint64_t sequence;
+            T             value;
+        };
+
+        explicit calendar_queue(Time width = Time(1), std::size_t nBuckets = min_buckets)
+            : m_width(width)
+        {
+            GEOMETRIX_ASSERT(width > Time(0));
+            nBuckets = (std::max)(nBuckets, min_buckets);
+            std::size_t n = min_buckets;
+            while (n < nBuckets)
+                n <<= 1;
+            m_buckets.resize(n);
+            m_invWidth = Time(1) / m_width;
+        }
+
+        bool        empty() const { return m_size == 0; }
+        std::size_t size() const { return m_size; }
+        std::size_t get_number_buckets() const { return m_buckets.size(); }
+        Time        get_bucket_width() const { return m_width; }
+
+        void push(Time t, const T& v)
+        {
+            insert(entry{ t, m_sequence++, v });
+            if (m_size > 2 * m_buckets.size())
+                resize(2 * m_buckets.size());
+        }
+
+        //! The earliest entry.
+        const entry& top() const
+        {
+            GEOMETRIX_ASSERT(!empty());
+            return m_buckets[find_next()].back();
+        }
+
+        entry pop()
+        {
+            GEOMETRIX_ASSERT(!empty());
+            auto& b = m_buckets[find_next()];
+            entry e = std::move(b.back());
+            b.pop_back();
+            --m_size;
+            if (m_buckets.size() > min_buckets && m_size < m_buckets.size() / 2)
+                resize(m_buckets.size() / 2);
+            return e;
+        }
+
+        void clear()
+        {
+            for (auto& b : m_buckets)
+                b.clear();
+            m_size = 0;
+        }
+
+    private:
+
+        BOOST_STATIC_CONSTEXPR std::size_t min_buckets = 16;
+
+        static bool before(const entry& a, const entry& b)
+        {
+            return a.time < b.time || (a.time == b.time && a.sequence < b.sequence);
+        }
+
+        std::int64_t get_day(Time t) const
+        {
+            return static_cast<std::int64_t>(std::floor(t * m_invWidth));
+        }
+
+        std::size_t get_bucket(std::int64_t day) const
+        {
+            return static_cast<std::size_t>(day) & (m_buckets.size() - 1);
+        }
+
+        void insert(entry&& e)
+        {
+            auto day = get_day(e.time);
+            //! Each bucket is sorted descending so the earliest entry is at the back. Buckets hold a few entries on average.
+            auto& b = m_buckets[get_bucket(day)];
+            auto it = std::upper_bound(b.begin(), b.end(), e, [](const entry& a, const entry& x) { return before(x, a); });
+            b.insert(it, std::move(e));
+            if (m_size++ == 0 || day < m_day)
+                m_day = day;
+        }
+
+        //! Find the bucket holding the earliest entry and move the current day to it.
+        std::size_t find_next() const
+        {
+            auto nbuckets = m_buckets.size();
+            auto day = m_day;
+            for (std::size_t n = 0; n < nbuckets; ++n, ++day)
+            {
+                const auto& b = m_buckets[get_bucket(day)];
+                if (!b.empty() && get_day(b.back().time) == day)
+                {
+                    m_day = day;
+                    return get_bucket(day);
+                }
+            }
+
+            //! A year of empty days; search the bucket heads directly.
+            std::size_t ibest = nbuckets;
+            for (std::size_t i = 0; i < nbuckets; ++i)
+            {
+                const auto& b = m_buckets[i];
+                if (!b.empty() && (ibest == nbuckets || before(b.back(), m_buckets[ibest].back())))
+                    ibest = i;
+            }
+
+            GEOMETRIX_ASSERT(ibest != nbuckets);
+            m_day = get_day(m_buckets[ibest].back().time);
+            return ibest;
+        }
+
+        void resize(std::size_t nBuckets)
+        {
+            std::vector<entry> entries;
+            entries.reserve(m_size);
+            for (auto& b : m_buckets)
+            {
+                std::move(b.begin(), b.end(), std::back_inserter(entries));
+                b.clear();
+            }
+
+            m_width = estimate_width(entries);
+            m_invWidth = Time(1) / m_width;
+            m_buckets.resize(nBuckets);
+            m_size = 0;
+            for (auto& e : entries)
+                insert(std::move(e));
+        }
+
+        //! Brown's heuristic: three times the average separation of the earliest events ignoring separations larger than twice the average.
+        Time estimate_width(std::vector<entry>& entries) const
+        {
+            BOOST_CONSTEXPR_OR_CONST std::size_t nsamples = 25;
+            if (entries.size() < 2)
+                return m_width;
+
+            auto n = (std::min)(nsamples, entries.size());
+            std::partial_sort(entries.begin(), entries.begin() + n, entries.end(), before);
+            auto avg = (entries[n - 1].time - entries[0].time) / static_cast<Time>(n - 1);
+            auto sum = Time(0);
+            std::size_t count = 0;
+            for (std::size_t i = 1; i < n; ++i)
+            {
+                auto d = entries[i].time - entries[i - 1].time;
+                if (d <= Time(2) * avg)
+                {
+                    sum += d;
+                    ++count;
+                }
+            }
+
+            if (count == 0 || sum <= Time(0))
+                return m_width;
+            return Time(3) * sum / static_cast<Time>(count);
+        }
+
+        std::vector<std::vector<entry>> m_buckets;
+        Time                            m_width;
+        Time                            m_invWidth;
+        mutable std::int64_t            m_day{ 0 };
+        std::size_t                     m_size{ 0 };
+        std::uint64_t                   m_sequence{ 0 };
+
+    };
+
+}//! namespace stk;
+
+#endif//! STK_CONTAINER_CALENDAR_QUEUE_HPP
@@ -0,0 +1,235 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef STK_CONTAINER_DOUBLE_BUFFERED_SOA_HPP
+#define STK_CONTAINER_DOUBLE_BUFFERED_SOA_HPP
+#pragma once
+
+#include <stk/utility/span.hpp>
+#include <geometrix/utility/assert.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace stk {
+
+    namespace detail {
+
+        template <typename T, typename... Ts>
+        struct type_index_of;
+
+        template <typename T, typename... Ts>
+        struct type_index_of<T, T, Ts...> : std::integral_constant<std::size_t, 0> {};
+
+        template <typename T, typename U, typename... Ts>
+        struct type_index_of<T, U, Ts...> : std::integral_constant<std::size_t, 1 + type_index_of<T, Ts...>::value> {};
+
+        template <typename T>
+        struct double_buffered_column
+        {
+            std::vector<T> buffers[2];
+            std::uint8_t   front{ 0 };
+            bool           dirty{ false };
+
+            const std::vector<T>& get_front() const { return buffers[front]; }
+            std::vector<T>&       get_back() { return buffers[front ^ 1]; }
+        };
+
+    }//! namespace detail;
+
+    //! A read only view of the front buffers of a double_buffered_soa. It holds spans so it may be copied into tasks and grid visitors.
+    template <typename... Ts>
+    class soa_front_view
+    {
+    public:
+
+        explicit soa_front_view(const std::tuple<stk::span<const Ts>...>& columns)
+            : m_columns(columns)
+        {}
+
+        template <typename T>
+        stk::span<const T> get() const { return std::get<stk::span<const T>>(m_columns); }
+
+        template <typename T>
+        const T& get(std::size_t i) const { return std::get<stk::span<const T>>(m_columns)[i]; }
+
+    private:
+
+        std::tuple<stk::span<const Ts>...> m_columns;
+
+    };
+
+    //! Double buffered structure of arrays for agent state. Each column type T holds one value per agent. During a tick all reads go to the
+    //! front buffers and writes go to the back buffers so an agent may read its neighbours' state while updating its own without locks
+    //! (e.g. from a collision_grid visitor using a front view.) swap_buffers() at the tick barrier publishes the written columns; only the
+    //! columns which were written (accessed through back()) are swapped and then copied so the new back buffer starts equal to the new front.
+    //! The column types must be distinct.
+    //! NOTE: Obtain the back spans before dispatching parallel work (as parallel_update does); back() marks the column dirty and is not thread safe.
+    template <typename... Ts>
+    class double_buffered_soa
+    {
+        template <typename T>
+        using index_of = detail::type_index_of<T, Ts...>;
+
+    public:
+
+        using front_view = soa_front_view<Ts...>;
+
+        double_buffered_soa() = default;
+
+        explicit double_buffered_soa(std::size_t n)
+        {
+            resize(n);
+        }
+
+        std::size_t size() const { return m_size; }
+
+        //! Resize both buffers of every column (new agents are value initialized.)
+        void resize(std::size_t n)
+        {
+            for_each_column([n](auto& c)
+            {
+                c.buffers[0].resize(n);
+                c.buffers[1].resize(n);
+            });
+            m_size = n;
+        }
+
+        template <typename T>
+        stk::span<const T> front() const
+        {
+            return column<T>().get_front();
+        }
+
+        template <typename T>
+        const T& front(std::size_t i) const
+        {
+            GEOMETRIX_ASSERT(i < m_size);
+            return column<T>().get_front()[i];
+        }
+
+        template <typename T>
+        stk::span<T> back()
+        {
+            auto& c = column<T>();
+            c.dirty = true;
+            return c.get_back();
+        }
+
+        template <typename T>
+        bool is_dirty() const
+        {
+            return column<T>().dirty;
+        }
+
+        front_view get_front_view() const
+        {
+            return front_view(std::make_tuple(front<Ts>()...));
+        }
+
+        //! Set the value of agent i in both buffers (e.g. when initializing or spawning agents between ticks.)
+        template <typename T>
+        void set(std::size_t i, const T& v)
+        {
+            GEOMETRIX_ASSERT(i < m_size);
+            auto& c = column<T>();
+            c.buffers[0][i] = v;
+            c.buffers[1][i] = v;
+        }
+
+        //! Publish the back buffers of the dirty columns.
+        void swap_buffers()
+        {
+            for_each_column([](auto& c)
+            {
+                if (c.dirty)
+                    swap_column(c);
+            });
+        }
+
+        //! Publish the back buffers of the dirty columns copying the columns concurrently on pool.
+        template <typename Pool>
+        void swap_buffers(Pool& pool)
+        {
+            std::vector<void(*)(double_buffered_soa&)> dirty;
+            collect_dirty(dirty, std::index_sequence_for<Ts...>());
+            if (dirty.size() < 2)
+            {
+                for (auto f : dirty)
+                    f(*this);
+                return;
+            }
+
+            pool.parallel_apply(static_cast<std::ptrdiff_t>(dirty.size()), [this, &dirty](std::ptrdiff_t i) { dirty[i](*this); });
+        }
+
+        //! Call fn(i, front_view, W&...) for each agent i concurrently on pool in chunks of chunkSize agents where W... are the columns written.
+        template <typename... W, typename Pool, typename Fn>
+        void parallel_update(Pool& pool, Fn&& fn, std::size_t chunkSize = 1024)
+        {
+            GEOMETRIX_ASSERT(chunkSize > 0);
+            auto reader = get_front_view();
+            auto writers = std::make_tuple(back<W>()...);
+            auto n = m_size;
+            auto nchunks = (n + chunkSize - 1) / chunkSize;
+            pool.parallel_apply(static_cast<std::ptrdiff_t>(nchunks), [&](std::ptrdiff_t c)
+            {
+                auto first = static_cast<std::size_t>(c) * chunkSize;
+                auto last = (std::min)(first + chunkSize, n);
+                for (auto i = first; i < last; ++i)
+                    fn(i, reader, std::get<stk::span<W>>(writers)[i]...);
+            });
+        }
+
+    private:
+
+        template <typename T>
+        detail::double_buffered_column<T>& column()
+        {
+            return std::get<index_of<T>::value>(m_columns);
+        }
+
+        template <typename T>
+        const detail::double_buffered_column<T>& column() const
+        {
+            return std::get<index_of<T>::value>(m_columns);
+        }
+
+        template <typename Fn>
+        void for_each_column(Fn&& fn)
+        {
+            (void)std::initializer_list<int>{ (fn(std::get<detail::double_buffered_column<Ts>>(m_columns)), 0)... };
+        }
+
+        template <typename T>
+        static void swap_column(detail::double_buffered_column<T>& c)
+        {
+            c.front ^= 1;
+            const auto& f = c.buffers[c.front];
+            std::copy(f.begin(), f.end(), c.get_back().begin());
+            c.dirty = false;
+        }
+
+        template <std::size_t... I>
+        void collect_dirty(std::vector<void(*)(double_buffered_soa&)>& dirty, std::index_sequence<I...>)
+        {
+            (void)std::initializer_list<int>{ (std::get<I>(m_columns).dirty ? (dirty.push_back([](double_buffered_soa& s) { swap_column(std::get<I>(s.m_columns)); }), 0) : 0)... };
+        }
+
+        std::tuple<detail::double_buffered_column<Ts>...> m_columns;
+        std::size_t                                       m_size{ 0 };
+
+    };
+
+}//! namespace stk;
+
+#endif//! STK_CONTAINER_DOUBLE_BUFFERED_SOA_HPP
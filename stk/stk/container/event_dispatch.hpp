@@ -62,10 +62,10 @@ namespace stk {
             m_listeners.emplace(std::make_pair((Key)(key), std::forward<Fn>(fn)));
         }
         
-        template <typename Key>
-        void remove_listener(const Key& key)
+        template <typename ObserverKey>
+        void remove_listener(ObserverKey key)
         {
-            m_listeners.erase(key);
+            m_listeners.erase((Key)(key));
         }
         
         template <typename ... Args>
@@ -0,0 +1,288 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef STK_CONTAINER_STRING_INTERNER_HPP
+#define STK_CONTAINER_STRING_INTERNER_HPP
+
+#if defined(_MSC_VER)
+    #pragma once
+#endif
+
+#include <stk/utility/fast_hash.hpp>
+#include <geometrix/utility/assert.hpp>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace stk {
+
+    //! Maps strings to dense 32 bit ids (0, 1, 2, ... in order of first interning) and back. The characters are copied into an arena
+    //! (null terminated) so the views returned are stable for the lifetime of the interner.
+    //!
+    //! find() and get() are lock-free: the ids are held in an open addressed table of 64 bit slots (the high 32 bits of the hash and
+    //! id + 1) which is read with atomic loads, and the entries in segments which never move. Interning a new string takes a mutex; a
+    //! table which grows is rebuilt and published, and the old one is kept until destruction for readers which may still probe it.
+    class string_interner
+    {
+        struct entry
+        {
+            const char* data;
+            std::size_t size;
+        };
+
+        struct table
+        {
+            explicit table(std::size_t capacity)
+                : mask(capacity - 1)
+                , slots(new std::atomic<std::uint64_t>[capacity])
+            {
+                for (std::size_t i = 0; i < capacity; ++i)
+                    slots[i].store(0, std::memory_order_relaxed);
+            }
+
+            std::size_t                                   mask;
+            std::unique_ptr<std::atomic<std::uint64_t>[]> slots;
+        };
+
+        //! Segment k holds ids [base * (2^k - 1), base * (2^(k+1) - 1)).
+        static constexpr std::size_t segment_base = 1024;
+        static constexpr std::size_t max_segments = 23;
+
+    public:
+
+        using id_type = std::uint32_t;
+        static constexpr id_type invalid_id = ~id_type(0);
+
+        explicit string_interner(std::size_t capacity = 1024, std::size_t chunkSize = 64 * 1024)
+            : m_chunkSize(chunkSize)
+        {
+            std::size_t n = 16;
+            while (n < 2 * capacity)
+                n *= 2;
+            m_tables.emplace_back(new table(n));
+            m_table.store(m_tables.back().get(), std::memory_order_release);
+            for (auto& s : m_segments)
+                s.store(nullptr, std::memory_order_relaxed);
+        }
+
+        string_interner(const string_interner&) = delete;
+        string_interner& operator=(const string_interner&) = delete;
+
+        ~string_interner()
+        {
+            for (auto& s : m_segments)
+                delete[] s.load(std::memory_order_relaxed);
+        }
+
+        //! The id of s (interning a copy of it when new.)
+        id_type intern(std::string_view s)
+        {
+            auto hash = fast_hash(s);
+            auto id = find(s, hash);
+            if (id != invalid_id)
+                return id;
+
+            std::unique_lock<std::mutex> lk{ m_mutex };
+            reserve_locked(m_size.load(std::memory_order_relaxed) + 1);
+            return insert_locked(s, hash);
+        }
+
+        //! Intern the strings of [first, last) writing their ids to out. Strings already present are looked up without locking and the
+        //! rest are interned under a single acquisition of the lock.
+        template <typename InputIt, typename OutputIt>
+        OutputIt intern(InputIt first, InputIt last, OutputIt out)
+        {
+            std::vector<std::string_view> keys;
+            std::vector<std::uint64_t> hashes;
+            std::vector<id_type> ids;
+            std::size_t misses = 0;
+            for (; first != last; ++first) {
+                keys.emplace_back(*first);
+                hashes.push_back(fast_hash(keys.back()));
+                ids.push_back(find(keys.back(), hashes.back()));
+                misses += ids.back() == invalid_id;
+            }
+
+            if (misses) {
+                std::unique_lock<std::mutex> lk{ m_mutex };
+                reserve_locked(m_size.load(std::memory_order_relaxed) + misses);
+                for (std::size_t i = 0; i < keys.size(); ++i)
+                    if (ids[i] == invalid_id)
+                        ids[i] = insert_locked(keys[i], hashes[i]);
+            }
+
+            for (auto id : ids)
+                *out++ = id;
+            return out;
+        }
+
+        //! The id of s or invalid_id when it has not been interned.
+        id_type find(std::string_view s) const noexcept
+        {
+            return find(s, fast_hash(s));
+        }
+
+        //! The interned string of id (which must have been returned by intern or find.) The view is null terminated.
+        std::string_view get(id_type id) const noexcept
+        {
+            GEOMETRIX_ASSERT(id < size());
+            auto& e = get_entry(id);
+            return std::string_view(e.data, e.size);
+        }
+
+        const char* c_str(id_type id) const noexcept
+        {
+            return get(id).data();
+        }
+
+        //! The number of interned strings.
+        std::size_t size() const noexcept
+        {
+            return m_size.load(std::memory_order_acquire);
+        }
+
+    private:
+
+        static std::size_t get_segment(std::size_t id) noexcept
+        {
+            auto v = id / segment_base + 1;
+#if defined(__GNUC__)
+            return static_cast<std::size_t>(63 - __builtin_clzll(static_cast<unsigned long long>(v)));
+#else
+            std::size_t k = 0;
+            while (v >>= 1)
+                ++k;
+            return k;
+#endif
+        }
+
+        const entry& get_entry(id_type id) const noexcept
+        {
+            auto k = get_segment(id);
+            auto segment = m_segments[k].load(std::memory_order_acquire);
+            return segment[id - segment_base * ((std::size_t(1) << k) - 1)];
+        }
+
+        id_type find(std::string_view s, std::uint64_t hash) const noexcept
+        {
+            auto t = m_table.load(std::memory_order_acquire);
+            auto tag = hash >> 32;
+            for (auto i = static_cast<std::size_t>(hash) & t->mask;; i = (i + 1) & t->mask) {
+                auto slot = t->slots[i].load(std::memory_order_acquire);
+                if (slot == 0)
+                    return invalid_id;
+                if ((slot >> 32) == tag) {
+                    auto id = static_cast<id_type>(slot) - 1;
+                    auto& e = get_entry(id);
+                    if (e.size == s.size() && (s.empty() || std::memcmp(e.data, s.data(), s.size()) == 0))
+                        return id;
+                }
+            }
+        }
+
+        //! Grow the table (under the lock) so it holds n ids at a load factor of at most 1/2.
+        void reserve_locked(std::size_t n)
+        {
+            auto t = m_table.load(std::memory_order_relaxed);
+            if (2 * n <= t->mask + 1)
+                return;
+
+            auto capacity = t->mask + 1;
+            while (capacity < 2 * n)
+                capacity *= 2;
+            std::unique_ptr<table> grown(new table(capacity));
+            for (std::size_t i = 0; i <= t->mask; ++i) {
+                auto slot = t->slots[i].load(std::memory_order_relaxed);
+                if (slot == 0)
+                    continue;
+                auto& e = get_entry(static_cast<id_type>(slot) - 1);
+                place(*grown, fast_hash(e.data, e.size), slot);
+            }
+            m_table.store(grown.get(), std::memory_order_release);
+            m_tables.push_back(std::move(grown));
+        }
+
+        static void place(table& t, std::uint64_t hash, std::uint64_t slot)
+        {
+            auto i = static_cast<std::size_t>(hash) & t.mask;
+            while (t.slots[i].load(std::memory_order_relaxed) != 0)
+                i = (i + 1) & t.mask;
+            t.slots[i].store(slot, std::memory_order_release);
+        }
+
+        //! Insert s (under the lock and with room in the table) unless another thread interned it since the lock free lookup.
+        id_type insert_locked(std::string_view s, std::uint64_t hash)
+        {
+            auto id = find(s, hash);
+            if (id != invalid_id)
+                return id;
+
+            auto n = m_size.load(std::memory_order_relaxed);
+            GEOMETRIX_ASSERT(n < invalid_id - 1);
+            id = static_cast<id_type>(n);
+            auto k = get_segment(id);
+            GEOMETRIX_ASSERT(k < max_segments);
+            auto segment = m_segments[k].load(std::memory_order_relaxed);
+            if (!segment) {
+                segment = new entry[segment_base << k];
+                m_segments[k].store(segment, std::memory_order_release);
+            }
+            segment[id - segment_base * ((std::size_t(1) << k) - 1)] = entry{ allocate(s), s.size() };
+
+            //! The entry is published by the release store of its slot.
+            place(*m_table.load(std::memory_order_relaxed), hash, ((hash >> 32) << 32) | (static_cast<std::uint64_t>(id) + 1));
+            m_size.store(n + 1, std::memory_order_release);
+            return id;
+        }
+
+        //! Copy s (null terminated) into the arena. Strings longer than a quarter of a chunk get their own allocation.
+        const char* allocate(std::string_view s)
+        {
+            auto n = s.size() + 1;
+            char* p;
+            if (4 * n > m_chunkSize) {
+                m_chunks.emplace_back(new char[n]);
+                p = m_chunks.back().get();
+            }
+            else {
+                if (n > m_chunkRemaining) {
+                    m_chunks.emplace_back(new char[m_chunkSize]);
+                    m_chunkNext = m_chunks.back().get();
+                    m_chunkRemaining = m_chunkSize;
+                }
+                p = m_chunkNext;
+                m_chunkNext += n;
+                m_chunkRemaining -= n;
+            }
+            if (!s.empty())
+                std::memcpy(p, s.data(), s.size());
+            p[s.size()] = 0;
+            return p;
+        }
+
+        std::atomic<table*>                           m_table{ nullptr };
+        std::array<std::atomic<entry*>, max_segments> m_segments;
+        std::atomic<std::size_t>                      m_size{ 0 };
+
+        std::mutex                                    m_mutex;
+        std::vector<std::unique_ptr<table>>           m_tables;//! the current table and those retired by growth.
+        std::vector<std::unique_ptr<char[]>>          m_chunks;
+        std::size_t                                   m_chunkSize;
+        char*                                         m_chunkNext{ nullptr };
+        std::size_t                                   m_chunkRemaining{ 0 };
+
+    };
+
+}//! namespace stk;
+
+#endif//! STK_CONTAINER_STRING_INTERNER_HPP
@@ -16,6 +16,7 @@
 #include <stk/geometry/primitive/point.hpp>
 #include <stk/units/boost_units.hpp>
 #include <stk/geometry/primitive/axis_aligned_bounding_box.hpp>
+#include <stk/utility/pimpl.hpp>
 #include <boost/optional.hpp>
 
 #include <vector>
@@ -54,6 +55,13 @@ public:
     rtree_cache(const Inputs& inputs, typename std::enable_if<std::is_default_constructible<CacheTraits>::value>::type* = nullptr)
         : rtree_cache(inputs, CacheTraits())
     {}
+
+    //! Defined in rtree_cache.ipp where rtree_cache_impl is complete.
+    rtree_cache(const rtree_cache&);
+    rtree_cache(rtree_cache&&);
+    ~rtree_cache();
+    rtree_cache& operator=(const rtree_cache&);
+    rtree_cache& operator=(rtree_cache&&);
     
     template <typename SelectionPolicy>
     boost::optional<Data> find(const point2& p, const SelectionPolicy& selector, const units::length& offset = 0.0001 * units::si::meters) const;
@@ -70,9 +78,12 @@ public:
 
 private:
 
+    //! The rtree is held in place (it is 24 bytes with the boost allocators) to save an allocation and an indirection per query.
+    using impl_t = fast_pimpl<rtree_cache_impl, 64>;
+
     CacheTraits                       mCacheTraits;
     std::vector<Data>                 mData;
-    std::shared_ptr<rtree_cache_impl> mPImpl;
+    impl_t                            mPImpl;
 };
 
 }//! namespace stk;
@@ -14,6 +14,7 @@
 #endif
 
 #include "rtree_cache.hpp"
+#include <stk/utility/pimpl.ipp>
 
 #include <boost/container/flat_set.hpp>
 
@@ -92,9 +93,24 @@ namespace stk {
 	inline rtree_cache<Data, CacheTraits>::rtree_cache(const Inputs& inputs, const CacheTraits& cacheTraits)
 		: mCacheTraits(cacheTraits)
 		, mData(inputs)
-		, mPImpl(std::make_shared<rtree_cache_impl>(inputs, cacheTraits))
+		, mPImpl(std::in_place, inputs, cacheTraits)
 	{}
 
+	template <typename Data, typename CacheTraits>
+	inline rtree_cache<Data, CacheTraits>::rtree_cache(const rtree_cache&) = default;
+
+	template <typename Data, typename CacheTraits>
+	inline rtree_cache<Data, CacheTraits>::rtree_cache(rtree_cache&&) = default;
+
+	template <typename Data, typename CacheTraits>
+	inline rtree_cache<Data, CacheTraits>::~rtree_cache() = default;
+
+	template <typename Data, typename CacheTraits>
+	inline rtree_cache<Data, CacheTraits>& rtree_cache<Data, CacheTraits>::operator=(const rtree_cache&) = default;
+
+	template <typename Data, typename CacheTraits>
+	inline rtree_cache<Data, CacheTraits>& rtree_cache<Data, CacheTraits>::operator=(rtree_cache&&) = default;
+
 	template <typename Data, typename CacheTraits /*= rtree_cache_traits<Data> */>
 	template <typename SelectionPolicy>
 	inline boost::optional<Data> rtree_cache<Data, CacheTraits>::find(const point2& p, const SelectionPolicy& selector, const units::length& offset /*= 0.0001 * units::si::meters*/) const
@@ -18,6 +18,7 @@
 #include <boost/random/uniform_real_distribution.hpp>
 #include <geometrix/arithmetic/math_kernel.hpp>
 #include <stk/math/math.hpp>
+#include <stk/random/point_sequence_traits.hpp>
 
 #include <vector>
 #include <mutex>
@@ -136,11 +137,22 @@ namespace stk {
             return geometrix::construct<Point>(m_mesh->get_random_position(random0, random1, random2));
         }
         
+        //! Generate a random position from either a uniform random bit generator or a 3 dimensional point sequence (e.g. stk::sobol_sequence<3>.)
+        //! Consecutive points of a low-discrepancy sequence cover the mesh more evenly than pseudo-random draws.
         template <typename Point, typename Generator>
         Point get_random_position(Generator& gen)
         {
-            boost::random::uniform_real_distribution<> U;
-            return geometrix::construct<Point>(m_mesh->get_random_position(U(gen), U(gen), U(gen)));
+            if constexpr (is_point_sequence<Generator>::value)
+            {
+                static_assert(Generator::dimension() >= 3, "biased_position_generator requires a point sequence with at least 3 dimensions.");
+                auto u = gen();
+                return geometrix::construct<Point>(m_mesh->get_random_position(u[0], u[1], u[2]));
+            }
+            else
+            {
+                boost::random::uniform_real_distribution<> U;
+                return geometrix::construct<Point>(m_mesh->get_random_position(U(gen), U(gen), U(gen)));
+            }
         }
 
 		mesh_type const& get_mesh() const
@@ -592,6 +604,7 @@ namespace stk {
 		}
 
 		//! Returns a random position in an optional if there was a position found within the specified number of attempts.
+		//! Gen may be a uniform random bit generator or a 3 dimensional point sequence (one point is consumed per attempt.)
 		template <typename Gen>
 		boost::optional<point2> get_random_position(Gen& gen, std::uint32_t maxAttempts = 100000) const
 		{
@@ -599,11 +612,26 @@ namespace stk {
 
 			point2 p;
 			do {
-                boost::random::uniform_real_distribution<> U;
-				auto rT = U(gen);
+				double rT, rx, ry;
+				if constexpr (is_point_sequence<Gen>::value)
+				{
+					static_assert(Gen::dimension() >= 3, "biased_position_grid requires a point sequence with at least 3 dimensions.");
+					auto u = gen();
+					rT = u[0];
+					rx = 2.0 * u[1] - 1.0;
+					ry = 2.0 * u[2] - 1.0;
+				}
+				else
+				{
+					boost::random::uniform_real_distribution<> U;
+					rT = U(gen);
+					auto U2 = boost::random::uniform_real_distribution<>{ -1.0, 1.0 };
+					rx = U2(gen);
+					ry = U2(gen);
+				}
 				auto it(std::lower_bound(m_integral.begin(), m_integral.end(), rT));
 				std::size_t i = std::distance(m_integral.begin(), it);
-				p = generate_random(i, gen);
+				p = generate_random(i, rx, ry);
 			} while (m_tree.point_in_solid_space(p, make_tolerance_policy()) != geometrix::point_in_solid_classification::in_empty_space && --maxAttempts > 0);
 
 			if (maxAttempts > 0)
@@ -614,18 +642,15 @@ namespace stk {
 
 	private:
 
-		//! Generate a random point inside a circle at m_position[i];
-		template <typename Gen>
-		point2 generate_random(std::size_t i, Gen& gen) const
+		//! Generate a point inside the cell at m_position[i] from the offsets rx, ry in [-1, 1].
+		point2 generate_random(std::size_t i, double rx, double ry) const
 		{
 			GEOMETRIX_ASSERT(i < m_positions.size());
-			using std::sqrt;
 
 			const auto vx = vector2{ m_halfcell, 0.0 * boost::units::si::meters };
 			const auto vy = vector2{ 0.0 * boost::units::si::meters, m_halfcell };
 
-			auto U = boost::random::uniform_real_distribution<>{ -1.0, 1.0 };
-			return m_positions[i] + U(gen) * vx + U(gen) * vy;
+			return m_positions[i] + rx * vx + ry * vy;
 		}
 
 		template <typename NumberComparisonPolicy>
@@ -0,0 +1,313 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include <geometrix/utility/assert.hpp>
+#include <stk/math/math.hpp>
+#include <stk/math/boost_units_math.hpp>
+#include <boost/units/quantity.hpp>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+namespace stk {
+
+    template <typename T, std::size_t N>
+    class dual;
+
+    template <typename T>
+    struct is_dual : std::false_type {};
+
+    template <typename T, std::size_t N>
+    struct is_dual<dual<T, N>> : std::true_type {};
+
+    namespace dual_detail {
+
+        //! The value 1 in the units of T (used to seed derivatives and to strip the units of angles.)
+        template <typename T>
+        struct unit_value
+        {
+            static T get() { return T(1); }
+        };
+
+        template <typename Unit, typename Y>
+        struct unit_value<boost::units::quantity<Unit, Y>>
+        {
+            static boost::units::quantity<Unit, Y> get() { return boost::units::quantity<Unit, Y>::from_value(Y(1)); }
+        };
+
+        template <typename T>
+        inline auto strip_units(const T& v) -> decltype(v / unit_value<T>::get())
+        {
+            return v / unit_value<T>::get();
+        }
+
+    }//! namespace dual_detail;
+
+    //! Forward mode automatic differentiation. A dual carries a value and its partial derivatives with respect to N independent parameters so that a
+    //! cost function evaluated on duals yields its value and gradient in one pass. T may be an arithmetic type or a boost::units quantity; the partial
+    //! derivatives have the units of the value (the parameters are dimensionless.)
+    template <typename T, std::size_t N>
+    class dual
+    {
+    public:
+
+        using value_type = T;
+        using gradient_type = std::array<T, N>;
+
+        static constexpr std::size_t size() { return N; }
+
+        dual()
+            : m_value()
+        {
+            m_gradient.fill(T());
+        }
+
+        //! A constant (all partial derivatives are zero.)
+        dual(const T& v)
+            : m_value(v)
+        {
+            m_gradient.fill(T());
+        }
+
+        dual(const T& v, const gradient_type& g)
+            : m_value(v)
+            , m_gradient(g)
+        {}
+
+        //! The ith independent parameter with value v.
+        static dual variable(const T& v, std::size_t i)
+        {
+            GEOMETRIX_ASSERT(i < N);
+            dual d(v);
+            d.m_gradient[i] = dual_detail::unit_value<T>::get();
+            return d;
+        }
+
+        const T&             value() const { return m_value; }
+        const gradient_type& gradient() const { return m_gradient; }
+        const T&             derivative(std::size_t i) const { GEOMETRIX_ASSERT(i < N); return m_gradient[i]; }
+
+        dual& operator +=(const dual& o)
+        {
+            m_value += o.m_value;
+            for (std::size_t i = 0; i < N; ++i)
+                m_gradient[i] += o.m_gradient[i];
+            return *this;
+        }
+
+        dual& operator -=(const dual& o)
+        {
+            m_value -= o.m_value;
+            for (std::size_t i = 0; i < N; ++i)
+                m_gradient[i] -= o.m_gradient[i];
+            return *this;
+        }
+
+        template <typename S, typename std::enable_if<!is_dual<S>::value, int>::type = 0>
+        dual& operator *=(const S& s)
+        {
+            m_value *= s;
+            for (std::size_t i = 0; i < N; ++i)
+                m_gradient[i] *= s;
+            return *this;
+        }
+
+        template <typename S, typename std::enable_if<!is_dual<S>::value, int>::type = 0>
+        dual& operator /=(const S& s)
+        {
+            m_value /= s;
+            for (std::size_t i = 0; i < N; ++i)
+                m_gradient[i] /= s;
+            return *this;
+        }
+
+        dual operator -() const
+        {
+            dual r(*this);
+            r.m_value = -r.m_value;
+            for (auto& g : r.m_gradient)
+                g = -g;
+            return r;
+        }
+
+        dual operator +() const { return *this; }
+
+    private:
+
+        T             m_value;
+        gradient_type m_gradient;
+
+    };
+
+    template <typename T, std::size_t N>
+    inline dual<T, N> operator +(dual<T, N> a, const dual<T, N>& b) { return a += b; }
+
+    template <typename T, std::size_t N>
+    inline dual<T, N> operator -(dual<T, N> a, const dual<T, N>& b) { return a -= b; }
+
+    template <typename T, std::size_t N>
+    inline dual<T, N> operator +(dual<T, N> a, const T& b) { return a += dual<T, N>(b); }
+
+    template <typename T, std::size_t N>
+    inline dual<T, N> operator +(const T& a, dual<T, N> b) { return b += dual<T, N>(a); }
+
+    template <typename T, std::size_t N>
+    inline dual<T, N> operator -(dual<T, N> a, const T& b) { return a -= dual<T, N>(b); }
+
+    template <typename T, std::size_t N>
+    inline dual<T, N> operator -(const T& a, const dual<T, N>& b) { return dual<T, N>(a) - b; }
+
+    //! Products and quotients may change units: d(ab) = a'b + ab', d(a/b) = (a'b - ab') / b^2.
+    template <typename T1, typename T2, std::size_t N>
+    inline auto operator *(const dual<T1, N>& a, const dual<T2, N>& b) -> dual<decltype(a.value() * b.value()), N>
+    {
+        using result_type = decltype(a.value() * b.value());
+        typename dual<result_type, N>::gradient_type g;
+        for (std::size_t i = 0; i < N; ++i)
+            g[i] = a.gradient()[i] * b.value() + a.value() * b.gradient()[i];
+        return { a.value() * b.value(), g };
+    }
+
+    template <typename T1, typename T2, std::size_t N>
+    inline auto operator /(const dual<T1, N>& a, const dual<T2, N>& b) -> dual<decltype(a.value() / b.value()), N>
+    {
+        using result_type = decltype(a.value() / b.value());
+        typename dual<result_type, N>::gradient_type g;
+        const auto inv = 1.0 / b.value();
+        const auto r = a.value() * inv;
+        for (std::size_t i = 0; i < N; ++i)
+            g[i] = (a.gradient()[i] - r * b.gradient()[i]) * inv;
+        return { r, g };
+    }
+
+    template <typename T, std::size_t N, typename S, typename std::enable_if<!is_dual<S>::value, int>::type = 0>
+    inline auto operator *(const dual<T, N>& a, const S& s) -> dual<decltype(a.value() * s), N>
+    {
+        typename dual<decltype(a.value() * s), N>::gradient_type g;
+        for (std::size_t i = 0; i < N; ++i)
+            g[i] = a.gradient()[i] * s;
+        return { a.value() * s, g };
+    }
+
+    template <typename S, typename T, std::size_t N, typename std::enable_if<!is_dual<S>::value, int>::type = 0>
+    inline auto operator *(const S& s, const dual<T, N>& a) -> dual<decltype(s * a.value()), N>
+    {
+        typename dual<decltype(s * a.value()), N>::gradient_type g;
+        for (std::size_t i = 0; i < N; ++i)
+            g[i] = s * a.gradient()[i];
+        return { s * a.value(), g };
+    }
+
+    template <typename T, std::size_t N, typename S, typename std::enable_if<!is_dual<S>::value, int>::type = 0>
+    inline auto operator /(const dual<T, N>& a, const S& s) -> dual<decltype(a.value() / s), N>
+    {
+        typename dual<decltype(a.value() / s), N>::gradient_type g;
+        for (std::size_t i = 0; i < N; ++i)
+            g[i] = a.gradient()[i] / s;
+        return { a.value() / s, g };
+    }
+
+    template <typename S, typename T, std::size_t N, typename std::enable_if<!is_dual<S>::value, int>::type = 0>
+    inline auto operator /(const S& s, const dual<T, N>& a) -> dual<decltype(s / a.value()), N>
+    {
+        typename dual<decltype(s / a.value()), N>::gradient_type g;
+        const auto r = s / a.value();
+        const auto inv = 1.0 / a.value();
+        for (std::size_t i = 0; i < N; ++i)
+            g[i] = -r * inv * a.gradient()[i];
+        return { r, g };
+    }
+
+    template <typename T, std::size_t N>
+    inline bool operator <(const dual<T, N>& a, const dual<T, N>& b) { return a.value() < b.value(); }
+
+    template <typename T, std::size_t N>
+    inline bool operator >(const dual<T, N>& a, const dual<T, N>& b) { return b.value() < a.value(); }
+
+    template <typename T, std::size_t N>
+    inline bool operator <=(const dual<T, N>& a, const dual<T, N>& b) { return !(b.value() < a.value()); }
+
+    template <typename T, std::size_t N>
+    inline bool operator >=(const dual<T, N>& a, const dual<T, N>& b) { return !(a.value() < b.value()); }
+
+    //! Apply the chain rule for f(a) given f(a) and f'(a) (with the units of a stripped.)
+    template <typename R, typename T, std::size_t N, typename D>
+    inline dual<R, N> chain(const dual<T, N>& a, const R& fa, const D& dfda)
+    {
+        typename dual<R, N>::gradient_type g;
+        for (std::size_t i = 0; i < N; ++i)
+            g[i] = dfda * a.gradient()[i];
+        return { fa, g };
+    }
+
+    //! The transcendental functions evaluate their values through stk::math (and boost_units_math for quantities) so results are reproducible.
+    template <typename T, std::size_t N>
+    inline dual<T, N> exp(const dual<T, N>& a)
+    {
+        auto e = stk::exp(a.value());
+        return chain(a, e, dual_detail::strip_units(e));
+    }
+
+    template <typename T, std::size_t N>
+    inline dual<T, N> log(const dual<T, N>& a)
+    {
+        return chain(a, stk::log(a.value()), 1.0 / dual_detail::strip_units(a.value()));
+    }
+
+    //! NOTE: sqrt and pow take the dual by value so they are preferred over the forwarding overloads in math.hpp.
+    template <typename T, std::size_t N>
+    inline auto sqrt(dual<T, N> a) -> dual<decltype(stk::sqrt(a.value())), N>
+    {
+        auto s = stk::sqrt(a.value());
+        typename dual<decltype(s), N>::gradient_type g;
+        for (std::size_t i = 0; i < N; ++i)
+            g[i] = a.gradient()[i] / (2.0 * s);
+        return { s, g };
+    }
+
+    //! Real valued power of an arithmetic dual.
+    template <typename T, std::size_t N, typename P, typename std::enable_if<std::is_arithmetic<T>::value && std::is_arithmetic<P>::value, int>::type = 0>
+    inline dual<T, N> pow(dual<T, N> a, P p)
+    {
+        auto v = stk::pow(a.value(), static_cast<T>(p));
+        return chain(a, v, static_cast<T>(p) * stk::pow(a.value(), static_cast<T>(p) - T(1)));
+    }
+
+    //! sin/cos accept arithmetic values or angle quantities (the derivative is taken per radian.)
+    template <typename T, std::size_t N>
+    inline auto sin(const dual<T, N>& a) -> dual<decltype(stk::sin(a.value())), N>
+    {
+        return chain(a, stk::sin(a.value()), stk::cos(a.value()) / dual_detail::unit_value<T>::get());
+    }
+
+    template <typename T, std::size_t N>
+    inline auto cos(const dual<T, N>& a) -> dual<decltype(stk::cos(a.value())), N>
+    {
+        return chain(a, stk::cos(a.value()), -stk::sin(a.value()) / dual_detail::unit_value<T>::get());
+    }
+
+    template <typename T, std::size_t N>
+    inline dual<T, N> abs(const dual<T, N>& a)
+    {
+        return a.value() < T() ? -a : a;
+    }
+
+    //! Seed the parameters theta as the N independent variables.
+    template <std::size_t N, typename Vector>
+    inline std::array<dual<double, N>, N> make_dual_variables(const Vector& theta)
+    {
+        std::array<dual<double, N>, N> vars;
+        for (std::size_t i = 0; i < N; ++i)
+            vars[i] = dual<double, N>::variable(theta[i], i);
+        return vars;
+    }
+
+}//! namespace stk;
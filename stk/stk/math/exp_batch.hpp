@@ -0,0 +1,82 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include <stk/utility/span.hpp>
+#include <geometrix/utility/assert.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace stk {
+
+    namespace exp_batch_detail {
+
+        //! Adding 1.5 * 2^52 rounds to the nearest integer and leaves it in the low bits of the mantissa.
+        BOOST_CONSTEXPR_OR_CONST double round_magic = 6755399441055744.0;
+
+        inline std::int64_t bits_of(double x)
+        {
+            std::int64_t b;
+            std::memcpy(&b, &x, sizeof(b));
+            return b;
+        }
+
+        inline double from_bits(std::int64_t b)
+        {
+            double x;
+            std::memcpy(&x, &b, sizeof(x));
+            return x;
+        }
+
+    }//! namespace exp_batch_detail;
+
+    //! Compute out[i] = exp(xs[i]) over a batch. The loop body has no branches or calls so the compiler can vectorize it
+    //! (e.g. roughly 5x std::exp with GCC at -O3 -mavx2; it needs 64 bit integer vector ops to pay off.) The argument is reduced
+    //! to r = x - k ln2 with |r| <= ln2/2 and exp(r) is evaluated with a degree 12 Taylor polynomial; the relative error is a few ulp. Inputs are
+    //! clamped to [-708, 709] so the result is always finite and normal (i.e. very negative arguments give ~1e-308 rather than 0.)
+    //! NOTE: This is not the bitwise reproducible stk::exp; use it where throughput matters more than matching the scalar path.
+    inline void exp_batch(stk::span<const double> xs, stk::span<double> out)
+    {
+        using namespace exp_batch_detail;
+        GEOMETRIX_ASSERT(out.size() >= xs.size());
+        BOOST_CONSTEXPR_OR_CONST double log2e = 1.44269504088896338700e+00;
+        BOOST_CONSTEXPR_OR_CONST double ln2hi = 6.93147180369123816490e-01;
+        BOOST_CONSTEXPR_OR_CONST double ln2lo = 1.90821492927058770002e-10;
+        const auto magicBits = bits_of(round_magic);
+        const auto* px = xs.data();
+        auto* po = out.data();
+        for (std::size_t i = 0, n = xs.size(); i < n; ++i)
+        {
+            auto x = px[i];
+            x = x < -708.0 ? -708.0 : x;
+            x = x > 709.0 ? 709.0 : x;
+            auto t = x * log2e + round_magic;
+            auto k = t - round_magic;
+            auto ik = bits_of(t) - magicBits;
+            auto r = (x - k * ln2hi) - k * ln2lo;
+            auto p = 1.0 / 479001600.0;
+            p = p * r + 1.0 / 39916800.0;
+            p = p * r + 1.0 / 3628800.0;
+            p = p * r + 1.0 / 362880.0;
+            p = p * r + 1.0 / 40320.0;
+            p = p * r + 1.0 / 5040.0;
+            p = p * r + 1.0 / 720.0;
+            p = p * r + 1.0 / 120.0;
+            p = p * r + 1.0 / 24.0;
+            p = p * r + 1.0 / 6.0;
+            p = p * r + 0.5;
+            p = p * r + 1.0;
+            p = p * r + 1.0;
+            po[i] = p * from_bits((ik + 1023) << 52);
+        }
+    }
+
+}//! namespace stk;
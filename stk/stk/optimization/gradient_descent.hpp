@@ -0,0 +1,56 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef STK_GRADIENT_DESCENT_HPP
+#define STK_GRADIENT_DESCENT_HPP
+
+#if defined(_MSC_VER)
+    #pragma once
+#endif
+
+#include <stk/math/dual.hpp>
+#include <stk/optimization/spsa.hpp>
+#include <geometrix/tensor/vector.hpp>
+#include <cmath>
+#include <utility>
+
+namespace stk {
+
+//! Evaluate a cost function and its exact gradient at theta in a single pass. The cost must be generic in its argument (e.g. a lambda taking const auto&)
+//! and index the parameters with operator[]; it is called with an array of dual<double, N>.
+template<std::size_t N, typename CostFunction>
+inline std::pair<double, geometrix::vector<double, N>> evaluate_gradient(const CostFunction& cost, const geometrix::vector<double, N>& theta)
+{
+    auto y = cost(make_dual_variables<N>(theta));
+    const auto& g = y.gradient();
+    return { y.value(), spsa_detail::generate<geometrix::vector<double, N>>([&g](std::size_t i) { return g[i]; }) };
+}
+
+//! Gradient descent using the SPSA gain sequence a_k = a / (k + 1 + A)^alpha with the gradient computed by forward mode differentiation.
+//! Costs which can be written generically converge much faster than with runtime_spsa as no perturbation noise enters the gradient; this is
+//! typically used to refine an estimate from a global search (e.g. simulated annealing or runtime_spsa.)
+template<std::size_t N, typename CostFunction>
+inline geometrix::vector<double, N> runtime_gradient_descent(geometrix::vector<double, N> theta, std::size_t k, const CostFunction& cost, double A = 0.1, double a = 0.1, double alpha = 0.602)
+{
+    using namespace geometrix;
+    using std::pow;
+    using State = geometrix::vector<double, N>;
+
+    for (std::size_t step = 0; step < k; ++step) {
+        auto ak = a / pow(step + 1.0 + A, alpha);
+        auto g = evaluate_gradient<N>(cost, theta).second;
+        State akg = ak * g;
+        theta = theta - akg;
+    }
+
+    return theta;
+}
+
+}//! namespace stk;
+
+#endif//STK_GRADIENT_DESCENT_HPP
@@ -0,0 +1,235 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef STK_MEMOIZED_COST_HPP
+#define STK_MEMOIZED_COST_HPP
+
+#if defined(_MSC_VER)
+    #pragma once
+#endif
+
+#include <geometrix/utility/assert.hpp>
+#include <boost/functional/hash.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace stk {
+
+    namespace memoized_cost_detail {
+
+        template <typename T, typename EnableIf = void>
+        struct is_indexable : std::false_type {};
+
+        template <typename T>
+        struct is_indexable<T, decltype((void)std::declval<const T&>().size(), (void)std::declval<const T&>()[0])> : std::true_type {};
+
+    }//! namespace memoized_cost_detail;
+
+    //! Maps a state to integer cells of width tolerance in each coordinate. Handles arithmetic states and containers of arithmetic values
+    //! with size() and operator[] (e.g. std::vector, std::array or geometrix::vector.)
+    struct grid_state_quantizer
+    {
+        explicit grid_state_quantizer(double tolerance = 0.0)
+            : m_invTolerance(tolerance > 0 ? 1.0 / tolerance : 0.0)
+        {}
+
+        template <typename State>
+        void operator()(const State& s, std::vector<std::int64_t>& key) const
+        {
+            key.clear();
+            if constexpr (memoized_cost_detail::is_indexable<State>::value) {
+                for (std::size_t i = 0; i < s.size(); ++i)
+                    key.push_back(quantize(static_cast<double>(s[i])));
+            }
+            else
+                key.push_back(quantize(static_cast<double>(s)));
+        }
+
+    private:
+
+        //! A tolerance of zero keys on the exact bit pattern.
+        std::int64_t quantize(double x) const
+        {
+            if (m_invTolerance == 0.0) {
+                std::int64_t bits;
+                x = x == 0.0 ? 0.0 : x;//! -0 == +0.
+                std::memcpy(&bits, &x, sizeof(bits));
+                return bits;
+            }
+
+            return static_cast<std::int64_t>(std::floor(x * m_invTolerance + 0.5));
+        }
+
+        double m_invTolerance;
+    };
+
+    struct memoized_cost_statistics
+    {
+        std::size_t hits{ 0 };//! served from a completed evaluation.
+        std::size_t waits{ 0 };//! served by waiting on an evaluation in progress on another thread.
+        std::size_t misses{ 0 };//! evaluated.
+        std::size_t evictions{ 0 };
+    };
+
+    //! A thread safe memoizing wrapper for an expensive cost function. States are keyed by their quantized coordinates so revisits of a
+    //! state (to within the tolerance) return the cached cost. The cache holds at most capacity entries evicting the least recently used.
+    //! Concurrent requests for a key which is being evaluated wait for that evaluation rather than running the cost again. If the cost
+    //! throws, the exception propagates to all waiting callers and the key is not cached.
+    //! The wrapper is itself a cost function (cost(state)) so it drops into the stk::optimization algorithms; it is not copyable so pass it
+    //! by reference (e.g. std::cref or a lambda) to algorithms taking the cost by value.
+    template <typename State, typename CostFunction, typename Quantizer = grid_state_quantizer>
+    class memoized_cost
+    {
+    public:
+
+        using cost_type = typename std::decay<decltype(std::declval<const CostFunction&>()(std::declval<const State&>()))>::type;
+
+        memoized_cost(CostFunction cost, std::size_t capacity, Quantizer quantizer = Quantizer())
+            : m_cost(std::move(cost))
+            , m_quantizer(std::move(quantizer))
+            , m_capacity(capacity)
+        {
+            GEOMETRIX_ASSERT(capacity > 0);
+        }
+
+        memoized_cost(const memoized_cost&) = delete;
+        memoized_cost& operator=(const memoized_cost&) = delete;
+
+        cost_type operator()(const State& s) const
+        {
+            key_type key;
+            m_quantizer(s, key);
+
+            std::promise<cost_type> promise;
+            std::uint64_t id;
+            {
+                std::unique_lock<std::mutex> lk{ m_mutex };
+                auto it = m_index.find(key);
+                if (it != m_index.end()) {
+                    //! Move to the front of the LRU list.
+                    m_lru.splice(m_lru.begin(), m_lru, it->second);
+                    auto result = it->second->result;
+                    auto ready = result.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+                    ++(ready ? m_statistics.hits : m_statistics.waits);
+                    lk.unlock();
+                    return result.get();
+                }
+
+                ++m_statistics.misses;
+                id = ++m_lastId;
+                m_lru.push_front(entry{ key, promise.get_future().share(), id });
+                m_index.emplace(std::move(key), m_lru.begin());
+                evict();
+            }
+
+            try {
+                auto c = m_cost(s);
+                promise.set_value(c);
+                return c;
+            }
+            catch (...) {
+                promise.set_exception(std::current_exception());
+                erase(s, id);
+                throw;
+            }
+        }
+
+        memoized_cost_statistics get_statistics() const
+        {
+            std::unique_lock<std::mutex> lk{ m_mutex };
+            return m_statistics;
+        }
+
+        std::size_t size() const
+        {
+            std::unique_lock<std::mutex> lk{ m_mutex };
+            return m_lru.size();
+        }
+
+        std::size_t get_capacity() const { return m_capacity; }
+
+        void clear()
+        {
+            std::unique_lock<std::mutex> lk{ m_mutex };
+            m_index.clear();
+            m_lru.clear();
+        }
+
+    private:
+
+        using key_type = std::vector<std::int64_t>;
+
+        struct entry
+        {
+            key_type                      key;
+            std::shared_future<cost_type> result;
+            std::uint64_t                 id;//! identifies the request which inserted the entry.
+        };
+
+        struct key_hash
+        {
+            std::size_t operator()(const key_type& k) const { return boost::hash_range(k.begin(), k.end()); }
+        };
+
+        //! Entries being evaluated may be evicted; their waiters hold the shared future.
+        void evict() const
+        {
+            while (m_lru.size() > m_capacity) {
+                m_index.erase(m_lru.back().key);
+                m_lru.pop_back();
+                ++m_statistics.evictions;
+            }
+        }
+
+        //! Erase the entry of the request id for s. The entry may have been evicted and the key since inserted by another request, whose
+        //! entry is left alone.
+        void erase(const State& s, std::uint64_t id) const
+        {
+            key_type key;
+            m_quantizer(s, key);
+            std::unique_lock<std::mutex> lk{ m_mutex };
+            auto it = m_index.find(key);
+            if (it != m_index.end() && it->second->id == id) {
+                m_lru.erase(it->second);
+                m_index.erase(it);
+            }
+        }
+
+        using lru_list = std::list<entry>;
+
+        CostFunction                                                           m_cost;
+        Quantizer                                                              m_quantizer;
+        std::size_t                                                            m_capacity;
+        mutable std::mutex                                                     m_mutex;
+        mutable lru_list                                                       m_lru;
+        mutable std::unordered_map<key_type, typename lru_list::iterator, key_hash> m_index;
+        mutable memoized_cost_statistics                                       m_statistics;
+        mutable std::uint64_t                                                  m_lastId{ 0 };
+
+    };
+
+    //! Memoize cost over states of type State with coordinates quantized to tolerance (0 for exact matches.)
+    template <typename State, typename CostFunction>
+    inline std::unique_ptr<memoized_cost<State, CostFunction>> make_memoized_cost(CostFunction cost, double tolerance, std::size_t capacity)
+    {
+        return std::make_unique<memoized_cost<State, CostFunction>>(std::move(cost), capacity, grid_state_quantizer(tolerance));
+    }
+
+}//! namespace stk;
+
+#endif//STK_MEMOIZED_COST_HPP
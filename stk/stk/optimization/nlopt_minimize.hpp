@@ -0,0 +1,287 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef STK_NLOPT_MINIMIZE_HPP
+#define STK_NLOPT_MINIMIZE_HPP
+
+#if defined(_MSC_VER)
+    #pragma once
+#endif
+
+#include <stk/math/dual.hpp>
+#include <geometrix/utility/assert.hpp>
+#include <nlopt.h>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <initializer_list>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace stk {
+
+struct nlopt_options
+{
+    nlopt_algorithm algorithm = NLOPT_GN_CRS2_LM;
+    std::size_t     max_evaluations = 10000;
+    double          max_seconds = 0;//! 0 for no time limit.
+    double          ftol_rel = 0;
+    double          xtol_rel = 1e-6;
+    std::size_t     population = 0;//! population of CRS, ISRES and ESCH (0 for the nlopt default.)
+    std::size_t     iteration_size = 0;//! evaluations per reported iteration (0 for the population or else 10 * (n + 1), the CRS default.)
+    std::size_t     restarts = 1;//! independent runs made by parallel_nlopt_minimize.
+    std::uint64_t   seed = 0x9E3779B97F4A7C15ULL;//! run r seeds the nlopt random number generator with seed + r.
+};
+
+struct nlopt_iteration_statistics
+{
+    std::size_t evaluations{ 0 };//! evaluations made in the iteration.
+    double      seconds{ 0 };//! wall time of the iteration.
+    double      min_cost{ 0 };//! best cost found by the end of the iteration.
+};
+
+struct nlopt_statistics
+{
+    nlopt_result                            status{ NLOPT_FAILURE };
+    bool                                    improved{ false };//! the run returned nlopt's optimum rather than the starting state.
+    double                                  min_cost{ std::numeric_limits<double>::infinity() };
+    std::size_t                             evaluations{ 0 };
+    double                                  seconds{ 0 };
+    std::vector<nlopt_iteration_statistics> iterations;
+};
+
+namespace nlopt_detail {
+
+    template <typename T>
+    struct is_tuple : std::false_type {};
+
+    template <typename... Ts>
+    struct is_tuple<std::tuple<Ts...>> : std::true_type {};
+
+    //! Parameters are an indexable container (e.g. std::vector or std::array) or a std::tuple whose elements are arithmetic or boost::units
+    //! quantities. Quantities are passed to nlopt as their values in their own units.
+    template <typename T>
+    inline double to_double(const T& v)
+    {
+        return static_cast<double>(dual_detail::strip_units(v));
+    }
+
+    template <typename T>
+    inline void from_double(double x, T& v)
+    {
+        v = x * dual_detail::unit_value<T>::get();
+    }
+
+    template <typename State>
+    inline std::size_t size(const State& s)
+    {
+        if constexpr (is_tuple<State>::value)
+            return std::tuple_size<State>::value;
+        else
+            return s.size();
+    }
+
+    template <typename State, std::size_t... I>
+    inline void tuple_to_doubles(const State& s, double* x, std::index_sequence<I...>)
+    {
+        (void)std::initializer_list<int>{ (x[I] = to_double(std::get<I>(s)), 0)... };
+    }
+
+    template <typename State, std::size_t... I>
+    inline void tuple_from_doubles(const double* x, State& s, std::index_sequence<I...>)
+    {
+        (void)std::initializer_list<int>{ (from_double(x[I], std::get<I>(s)), 0)... };
+    }
+
+    template <typename State>
+    inline void to_doubles(const State& s, double* x)
+    {
+        if constexpr (is_tuple<State>::value)
+            tuple_to_doubles(s, x, std::make_index_sequence<std::tuple_size<State>::value>());
+        else {
+            for (std::size_t i = 0; i < s.size(); ++i)
+                x[i] = to_double(s[i]);
+        }
+    }
+
+    template <typename State>
+    inline void from_doubles(const double* x, State& s)
+    {
+        if constexpr (is_tuple<State>::value)
+            tuple_from_doubles(x, s, std::make_index_sequence<std::tuple_size<State>::value>());
+        else {
+            for (std::size_t i = 0; i < s.size(); ++i)
+                from_double(x[i], s[i]);
+        }
+    }
+
+    template <typename State, typename CostFunction>
+    struct objective
+    {
+        using clock_type = std::chrono::steady_clock;
+
+        objective(const State& s0, const CostFunction& cost, std::size_t iterationSize, nlopt_statistics& stats)
+            : state(s0)
+            , cost(cost)
+            , iterationSize(iterationSize)
+            , stats(stats)
+            , iterationStart(clock_type::now())
+        {}
+
+        static double call(unsigned n, const double* x, double* grad, void* data)
+        {
+            GEOMETRIX_ASSERT(grad == nullptr);//! only derivative free algorithms are supported.
+            (void)n; (void)grad;
+            auto& self = *static_cast<objective*>(data);
+            try {
+                from_doubles(x, self.state);
+                auto c = to_double(self.cost(static_cast<const State&>(self.state)));
+                self.record(c);
+                return c;
+            }
+            catch (...) {
+                //! Exceptions must not cross the C library; stop and rethrow when nlopt returns.
+                self.error = std::current_exception();
+                nlopt_force_stop(self.opt);
+                return std::numeric_limits<double>::infinity();
+            }
+        }
+
+        void record(double c)
+        {
+            ++stats.evaluations;
+            ++iterationEvaluations;
+            if (c < stats.min_cost)
+                stats.min_cost = c;
+            if (iterationEvaluations == iterationSize)
+                end_iteration();
+        }
+
+        void end_iteration()
+        {
+            if (iterationEvaluations == 0)
+                return;
+            auto now = clock_type::now();
+            stats.iterations.push_back(nlopt_iteration_statistics{ iterationEvaluations, std::chrono::duration<double>(now - iterationStart).count(), stats.min_cost });
+            iterationEvaluations = 0;
+            iterationStart = now;
+        }
+
+        State                   state;
+        const CostFunction&     cost;
+        std::size_t             iterationSize;
+        nlopt_statistics&       stats;
+        clock_type::time_point  iterationStart;
+        std::size_t             iterationEvaluations{ 0 };
+        nlopt_opt               opt{ nullptr };
+        std::exception_ptr      error;
+    };
+
+}//! namespace nlopt_detail;
+
+//! Minimize cost(State) over the box [lower, upper] with a derivative free nlopt algorithm (e.g. NLOPT_GN_CRS2_LM, NLOPT_GN_ISRES,
+//! NLOPT_GN_ESCH or NLOPT_LN_BOBYQA) starting from s0. State may hold boost::units quantities (see nlopt_detail::to_double.)
+//! The evaluation counts and wall time of each iteration of options.iteration_size evaluations are written to stats when given; the
+//! nlopt status is reported there rather than thrown. Exceptions thrown by the cost stop the run and propagate.
+//! The optimum is returned for every status but NLOPT_INVALID_ARGS and NLOPT_OUT_OF_MEMORY (nlopt documents it as usable after e.g.
+//! NLOPT_ROUNDOFF_LIMITED); after a failure it must beat the cost of s0, which is evaluated once more for the comparison.
+template <typename State, typename CostFunction>
+inline State nlopt_minimize(const State& s0, const State& lower, const State& upper, const CostFunction& cost, const nlopt_options& options = nlopt_options(), nlopt_statistics* stats = nullptr)
+{
+    using clock_type = std::chrono::steady_clock;
+    auto n = nlopt_detail::size(s0);
+    GEOMETRIX_ASSERT(nlopt_detail::size(lower) == n && nlopt_detail::size(upper) == n);
+
+    std::vector<double> x(n), lb(n), ub(n);
+    nlopt_detail::to_doubles(s0, x.data());
+    nlopt_detail::to_doubles(lower, lb.data());
+    nlopt_detail::to_doubles(upper, ub.data());
+
+    nlopt_statistics localStats;
+    auto& s = stats ? *stats : localStats;
+    s = nlopt_statistics();
+    auto iterationSize = options.iteration_size ? options.iteration_size : (options.population ? options.population : 10 * (n + 1));
+    nlopt_detail::objective<State, CostFunction> obj(s0, cost, iterationSize, s);
+
+    auto opt = nlopt_create(options.algorithm, static_cast<unsigned>(n));
+    GEOMETRIX_ASSERT(opt != nullptr);
+    obj.opt = opt;
+    nlopt_set_min_objective(opt, &nlopt_detail::objective<State, CostFunction>::call, &obj);
+    nlopt_set_lower_bounds(opt, lb.data());
+    nlopt_set_upper_bounds(opt, ub.data());
+    nlopt_set_maxeval(opt, static_cast<int>(options.max_evaluations));
+    if (options.max_seconds > 0)
+        nlopt_set_maxtime(opt, options.max_seconds);
+    if (options.ftol_rel > 0)
+        nlopt_set_ftol_rel(opt, options.ftol_rel);
+    if (options.xtol_rel > 0)
+        nlopt_set_xtol_rel(opt, options.xtol_rel);
+    if (options.population > 0)
+        nlopt_set_population(opt, static_cast<unsigned>(options.population));
+
+    auto start = clock_type::now();
+    double minCost = std::numeric_limits<double>::infinity();
+    s.status = nlopt_optimize(opt, x.data(), &minCost);
+    s.seconds = std::chrono::duration<double>(clock_type::now() - start).count();
+    obj.end_iteration();
+    nlopt_destroy(opt);
+    if (obj.error)
+        std::rethrow_exception(obj.error);
+
+    State result = s0;
+    s.improved = s.status > 0 || (s.status != NLOPT_INVALID_ARGS && s.status != NLOPT_OUT_OF_MEMORY && minCost < std::numeric_limits<double>::infinity() && minCost < nlopt_detail::to_double(cost(s0)));
+    if (s.improved) {
+        s.min_cost = minCost;
+        nlopt_detail::from_doubles(x.data(), result);
+    }
+    return result;
+}
+
+//! nlopt evaluates the objective serially so a single run cannot be spread over a pool. For the stochastic population based algorithms
+//! (CRS, ISRES, ESCH) parallel_nlopt_minimize instead makes options.restarts independent runs concurrently with executor.parallel_apply
+//! (e.g. work_stealing_thread_pool), run r seeding nlopt with options.seed + r, and returns the best result. The cost must be safe to call
+//! concurrently and nlopt must be built with its thread local random number state (the default.) The statistics of each run are
+//! written to stats when given.
+template <typename State, typename CostFunction, typename Executor>
+inline State parallel_nlopt_minimize(const State& s0, const State& lower, const State& upper, const CostFunction& cost, Executor& executor, const nlopt_options& options = nlopt_options(), std::vector<nlopt_statistics>* stats = nullptr)
+{
+    GEOMETRIX_ASSERT(options.restarts > 0);
+    std::vector<State> results(options.restarts, s0);
+    std::vector<nlopt_statistics> runs(options.restarts);
+    std::vector<std::exception_ptr> errors(options.restarts);
+    executor.parallel_apply(static_cast<std::ptrdiff_t>(options.restarts), [&](std::ptrdiff_t r)
+    {
+        try {
+            nlopt_srand(static_cast<unsigned long>(options.seed + static_cast<std::uint64_t>(r)));
+            results[r] = nlopt_minimize(s0, lower, upper, cost, options, &runs[r]);
+        }
+        catch (...) {
+            errors[r] = std::current_exception();
+        }
+    });
+
+    for (auto& e : errors)
+        if (e)
+            std::rethrow_exception(e);
+
+    std::size_t best = 0;
+    for (std::size_t r = 1; r < runs.size(); ++r)
+        if (runs[r].improved && (!runs[best].improved || runs[r].min_cost < runs[best].min_cost))
+            best = r;
+
+    if (stats)
+        *stats = std::move(runs);
+    return results[best];
+}
+
+}//! namespace stk;
+
+#endif//STK_NLOPT_MINIMIZE_HPP
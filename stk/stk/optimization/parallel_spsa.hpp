@@ -0,0 +1,131 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef STK_PARALLEL_SPSA_HPP
+#define STK_PARALLEL_SPSA_HPP
+
+#if defined(_MSC_VER)
+    #pragma once
+#endif
+
+#include <stk/random/philox4x32_generator.hpp>
+#include <geometrix/utility/assert.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace stk {
+
+struct spsa_options
+{
+    std::size_t   samples = 1;//! independent perturbations averaged per iteration.
+    double        A = 0.1;
+    double        a = 0.1;
+    double        c = 0.1;
+    double        alpha = 0.602;
+    double        gamma = 0.101;
+    bool          common_random_numbers = true;//! evaluate each +/- pair with the same random number stream.
+    std::uint64_t seed = 0x5EED5EED5EED5EEDULL;//! seeds the perturbations (see parallel_spsa.)
+};
+
+namespace spsa_detail {
+
+    //! Call cost(theta, stream) when the cost accepts a random number stream index else cost(theta).
+    template <typename CostFunction, typename Vector>
+    inline double evaluate(const CostFunction& cost, const Vector& theta, std::uint64_t stream)
+    {
+        if constexpr (std::is_invocable<const CostFunction&, const Vector&, std::uint64_t>::value)
+            return static_cast<double>(cost(theta, stream));
+        else
+            return static_cast<double>(cost(theta));
+    }
+
+    //! The philox key of the perturbations: seed passed through the splitmix64 finalizer so it differs from seed itself.
+    inline std::uint64_t perturbation_key(std::uint64_t seed)
+    {
+        seed += 0x9E3779B97F4A7C15ULL;
+        seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBULL;
+        return seed ^ (seed >> 31);
+    }
+
+}//! namespace spsa_detail;
+
+//! SPSA for costs which are expensive and noisy (e.g. a simulation run.) Each iteration draws options.samples Bernoulli perturbations and
+//! evaluates all 2 * samples costs concurrently with executor.parallel_apply (e.g. work_stealing_thread_pool); the gradient estimates of the
+//! samples are averaged. Vector is any runtime sized vector of doubles with size() and operator[] (e.g. std::vector<double>.)
+//!
+//! A cost taking (const Vector& theta, std::uint64_t stream) receives the index of the random number stream it should use for its
+//! simulation (e.g. philox4x32_generator(seed, stream).) With common_random_numbers both evaluations of a pair share the stream so the noise
+//! largely cancels in the difference. The perturbations are generated from counter based streams so results do not depend on the schedule.
+//! Their philox key is a hash of options.seed (not options.seed itself) so a cost which keys its simulation with options.seed and the
+//! stream index does not draw the same sequence as the perturbation it is evaluating.
+template <typename Vector, typename CostFunction, typename Executor>
+inline Vector parallel_spsa(Vector theta, std::size_t k, const CostFunction& cost, Executor& executor, const spsa_options& options = spsa_options(), const Vector* scale = nullptr)
+{
+    using std::pow;
+    GEOMETRIX_ASSERT(options.samples > 0);
+    const auto n = theta.size();
+    GEOMETRIX_ASSERT(scale == nullptr || scale->size() == n);
+    const auto nsamples = options.samples;
+
+    std::vector<double> deltas(nsamples * n);
+    std::vector<Vector> points(2 * nsamples, theta);
+    std::vector<double> y(2 * nsamples);
+    std::vector<double> gradient(n);
+    const auto key = spsa_detail::perturbation_key(options.seed);
+    for (std::size_t step = 0; step < k; ++step) {
+        auto ak = options.a / pow(step + 1.0 + options.A, options.alpha);
+        auto ck = options.c / pow(step + 1.0, options.gamma);
+
+        //! Perturbation s of this step is drawn from its own stream.
+        for (std::size_t s = 0; s < nsamples; ++s) {
+            philox4x32_generator rng(key, step * nsamples + s, 0);
+            std::uint64_t bits = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                if (i % 64 == 0)
+                    bits = rng();
+                auto d = (bits & 1) ? 1.0 : -1.0;
+                bits >>= 1;
+                deltas[s * n + i] = d * (scale ? (*scale)[i] : 1.0);
+            }
+
+            auto& plus = points[2 * s];
+            auto& minus = points[2 * s + 1];
+            for (std::size_t i = 0; i < n; ++i) {
+                plus[i] = theta[i] + ck * deltas[s * n + i];
+                minus[i] = theta[i] - ck * deltas[s * n + i];
+            }
+        }
+
+        executor.parallel_apply(static_cast<std::ptrdiff_t>(2 * nsamples), [&](std::ptrdiff_t j)
+        {
+            auto pair = static_cast<std::uint64_t>(step * nsamples + j / 2);
+            auto stream = options.common_random_numbers ? pair : 2 * pair + (j % 2);
+            y[j] = spsa_detail::evaluate(cost, points[j], stream);
+        });
+
+        std::fill(gradient.begin(), gradient.end(), 0.0);
+        for (std::size_t s = 0; s < nsamples; ++s) {
+            auto ydiff = y[2 * s] - y[2 * s + 1];
+            for (std::size_t i = 0; i < n; ++i)
+                gradient[i] += ydiff / (2.0 * ck * deltas[s * n + i]);
+        }
+
+        for (std::size_t i = 0; i < n; ++i)
+            theta[i] -= ak * gradient[i] / static_cast<double>(nsamples);
+    }
+
+    return theta;
+}
+
+}//! namespace stk;
+
+#endif//STK_PARALLEL_SPSA_HPP
@@ -0,0 +1,139 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef STK_PARALLEL_TEMPERING_HPP
+#define STK_PARALLEL_TEMPERING_HPP
+
+#if defined(_MSC_VER)
+    #pragma once
+#endif
+
+#include <stk/random/philox4x32_generator.hpp>
+#include <geometrix/utility/assert.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace stk {
+
+struct parallel_tempering_options
+{
+    std::size_t   chains = 8;//! number of replicas.
+    double        ladder_ratio = 2.0;//! chain m runs at temp(k) * ladder_ratio^m.
+    std::size_t   exchange_interval = 100;//! steps each chain takes between replica exchanges.
+    std::uint64_t seed = 0x7E3B1A5C9D2F4E61ULL;//! seeds the per chain random number streams.
+};
+
+namespace parallel_tempering_detail {
+
+    //! A neighbor function may take the chain's random number generator as a second argument; otherwise it must be safe to call concurrently.
+    template <typename NeighborFn, typename State, typename Engine>
+    inline State get_neighbor(const NeighborFn& neighbor, const State& s, Engine& rng)
+    {
+        if constexpr (std::is_invocable<const NeighborFn&, const State&, Engine&>::value)
+            return neighbor(s, rng);
+        else
+            return neighbor(s);
+    }
+
+}//! namespace parallel_tempering_detail;
+
+//! Parallel tempering (replica exchange Monte Carlo.) M chains run the same Metropolis moves as runtime_simulated_annealing at temperatures
+//! temp(k) * ladder_ratio^m for the remaining steps k so the hot chains explore while the cold chains refine. Every exchange_interval steps the
+//! chains run concurrently on the executor (executor.parallel_apply, e.g. work_stealing_thread_pool) and then adjacent temperatures swap states
+//! with probability min(1, exp((E_i - E_j)(1/T_i - 1/T_j))), alternating between even and odd pairs. Each chain draws from its own
+//! philox4x32_generator stream and the best state of all chains is merged after each round, so the result does not depend on the schedule.
+//! Returns the best state found; the cost of it is written to minCost when given.
+template<typename State, typename CostFunction, typename TemperatureSchedule, typename NeighborFn, typename Executor>
+inline State parallel_tempering(State s0, std::size_t k, const CostFunction& cost, const TemperatureSchedule& temp, const NeighborFn& neighbor, Executor& executor, const parallel_tempering_options& options = parallel_tempering_options(), decltype(cost(s0))* minCost = nullptr)
+{
+    using std::exp;
+    using std::pow;
+    using cost_type = decltype(cost(s0));
+    GEOMETRIX_ASSERT(options.chains > 0 && options.exchange_interval > 0);
+
+    struct chain
+    {
+        State                state;
+        cost_type            cost;
+        State                best;
+        cost_type            bestCost;
+        philox4x32_generator rng;
+    };
+
+    const auto nchains = options.chains;
+    auto c0 = cost(s0);
+    std::vector<chain> chains;
+    chains.reserve(nchains);
+    for (std::size_t m = 0; m < nchains; ++m)
+        chains.push_back(chain{ s0, c0, s0, c0, philox4x32_generator(options.seed, m) });
+
+    std::vector<double> ladder(nchains);
+    for (std::size_t m = 0; m < nchains; ++m)
+        ladder[m] = pow(options.ladder_ratio, static_cast<double>(m));
+
+    State sMin = s0;
+    cost_type best = c0;
+    philox4x32_generator exchangeRng(options.seed, nchains);
+    boost::random::uniform_real_distribution<double> U;
+    std::size_t round = 0;
+    while (k > 0) {
+        auto nsteps = (std::min)(options.exchange_interval, k);
+        executor.parallel_apply(static_cast<std::ptrdiff_t>(nchains), [&, k, nsteps](std::ptrdiff_t m)
+        {
+            auto& c = chains[m];
+            boost::random::uniform_real_distribution<double> u;
+            for (std::size_t i = 0; i < nsteps; ++i) {
+                State sNext = parallel_tempering_detail::get_neighbor(neighbor, c.state, c.rng);
+                auto nextCost = cost(sNext);
+                auto t = temp(k - i) * ladder[m];
+                if (nextCost < c.cost || exp((-1.0 * (nextCost - c.cost)) / t) > u(c.rng)) {
+                    c.state = std::move(sNext);
+                    c.cost = nextCost;
+                    if (c.cost < c.bestCost) {
+                        c.best = c.state;
+                        c.bestCost = c.cost;
+                    }
+                }
+            }
+        });
+        k -= nsteps;
+
+        for (auto& c : chains) {
+            if (c.bestCost < best) {
+                sMin = c.best;
+                best = c.bestCost;
+            }
+        }
+
+        //! Replica exchange between neighbouring temperatures (the states move; the temperatures and streams stay with the slots.)
+        auto t = temp(k + 1);
+        for (auto i = round % 2; i + 1 < nchains; i += 2) {
+            auto& a = chains[i];
+            auto& b = chains[i + 1];
+            auto x = (a.cost - b.cost) * (1.0 / (t * ladder[i]) - 1.0 / (t * ladder[i + 1]));
+            if (x >= 0 || exp(x) > U(exchangeRng)) {
+                std::swap(a.state, b.state);
+                std::swap(a.cost, b.cost);
+            }
+        }
+        ++round;
+    }
+
+    if (minCost)
+        *minCost = best;
+    return sMin;
+}
+
+}//! namespace stk;
+
+#endif//STK_PARALLEL_TEMPERING_HPP
@@ -13,6 +13,12 @@
     #pragma once
 #endif
 
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
 namespace stk {
     
 template<typename State, typename CostFunction, typename NeighborFn>
@@ -35,6 +41,60 @@ inline State random_search(State currS, std::size_t k, const CostFunction& cost,
     return sMin;
 }
 
+struct random_search_options
+{
+    std::size_t                         batch_size = 8;//! neighbors generated and evaluated per round.
+    std::size_t                         max_stall_rounds = (std::numeric_limits<std::size_t>::max)();//! stop after this many rounds without improvement.
+    double                              target_cost = -(std::numeric_limits<double>::infinity)();//! stop once the cost is at or below this.
+    std::chrono::steady_clock::duration time_budget = (std::chrono::steady_clock::duration::max)();//! stop when a round ends after this much time.
+};
+
+//! Random search which generates options.batch_size neighbors of the current state per round and evaluates them concurrently through
+//! executor.for_each (e.g. thread_pool_executor or seq_executor.) The best neighbor is accepted when it improves on the best state so far.
+//! The neighbors are generated on the calling thread so a neighbor function holding a random number generator need not be thread safe.
+//! Runs at most k rounds and stops early on the target cost, after max_stall_rounds without improvement or when the time budget is spent.
+template<typename State, typename CostFunction, typename NeighborFn, typename Executor>
+inline State random_search(State currS, std::size_t k, const CostFunction& cost, const NeighborFn& neighbor, Executor& executor, const random_search_options& options = random_search_options(), decltype(cost(currS))* minCostOut = nullptr)
+{
+    using cost_type = decltype(cost(currS));
+    auto start = std::chrono::steady_clock::now();
+    auto minCost = cost(currS);
+    std::vector<State> candidates;
+    std::vector<cost_type> costs(options.batch_size);
+    std::vector<std::size_t> indices(options.batch_size);
+    std::iota(indices.begin(), indices.end(), std::size_t{});
+    std::size_t stalled = 0;
+
+    for (; k > 0 && !(minCost <= options.target_cost); --k) {
+        candidates.clear();
+        for (std::size_t i = 0; i < options.batch_size; ++i)
+            candidates.push_back(neighbor(currS));
+
+        executor.for_each(indices, [&](std::size_t i) { costs[i] = cost(candidates[i]); });
+
+        //! Ties go to the lowest index so the result does not depend on the executor.
+        std::size_t ibest = 0;
+        for (std::size_t i = 1; i < candidates.size(); ++i)
+            if (costs[i] < costs[ibest])
+                ibest = i;
+
+        if (!candidates.empty() && costs[ibest] < minCost) {
+            minCost = costs[ibest];
+            currS = std::move(candidates[ibest]);
+            stalled = 0;
+        }
+        else if (++stalled >= options.max_stall_rounds)
+            break;
+
+        if (std::chrono::steady_clock::now() - start >= options.time_budget)
+            break;
+    }
+
+    if (minCostOut)
+        *minCostOut = minCost;
+    return currS;
+}
+
 }//! namespace stk;
 
 #endif//STK_RANDOM_SEARCH_HPP
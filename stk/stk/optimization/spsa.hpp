@@ -71,6 +71,8 @@ namespace spsa_detail
 }//! spsa_detail;
 
 // Simulated annealing ripped off from stack exchange.
+//! NOTE: When the cost can be written generically it may be differentiated exactly; see runtime_gradient_descent in gradient_descent.hpp.
+//! For expensive costs or runtime sized parameters see parallel_spsa in parallel_spsa.hpp.
 template<std::size_t N, typename CostFunction, typename BernoulliGenerator>
 inline geometrix::vector<double, N> runtime_spsa(geometrix::vector<double, N> theta, std::size_t k, const CostFunction& cost, BernoulliGenerator& rng, double A = 0.1, double a = 0.1, double c = 0.1, double alpha = 0.602, double gamma = 0.101, const geometrix::vector<double, N>& scale = spsa_detail::generate<geometrix::vector<double, N>>([](int) {return 1.0; }))
 {
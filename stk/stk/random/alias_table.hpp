@@ -0,0 +1,131 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include <geometrix/utility/assert.hpp>
+#include <boost/config.hpp>
+#include <random>
+#include <vector>
+#include <cstdint>
+
+namespace stk {
+
+    //! Walker/Vose alias table for O(1) sampling of an index from a discrete distribution defined by non-negative weights.
+    template <typename T = double>
+    class alias_table
+    {
+    public:
+
+        alias_table() = default;
+
+        template <typename Range>
+        explicit alias_table(const Range& weights)
+        {
+            build(std::begin(weights), std::end(weights));
+        }
+
+        template <typename Iterator>
+        alias_table(Iterator first, Iterator last)
+        {
+            build(first, last);
+        }
+
+        std::size_t size() const { return m_prob.size(); }
+        bool        empty() const { return m_prob.empty(); }
+
+        //! Map a single uniform variate u in [0, 1) to an index. The integer part of u * size() selects the column and the fractional part flips the coin.
+        std::size_t operator()(T u) const
+        {
+            GEOMETRIX_ASSERT(!empty());
+            auto n = m_prob.size();
+            auto x = u * static_cast<T>(n);
+            auto i = static_cast<std::size_t>(x);
+            if (BOOST_UNLIKELY(i >= n))
+                i = n - 1;
+            return (x - static_cast<T>(i)) < m_prob[i] ? i : m_alias[i];
+        }
+
+        template <typename Engine>
+        std::size_t operator()(Engine& e) const
+        {
+            std::uniform_real_distribution<T> U;
+            return (*this)(U(e));
+        }
+
+        //! The probability of accepting column i before falling through to its alias.
+        T             get_probability(std::size_t i) const { return m_prob[i]; }
+        std::uint32_t get_alias(std::size_t i) const { return m_alias[i]; }
+
+    private:
+
+        template <typename Iterator>
+        void build(Iterator first, Iterator last)
+        {
+            std::vector<T> w(first, last);
+            auto n = w.size();
+            m_prob.assign(n, T{});
+            m_alias.assign(n, 0);
+            if (n == 0)
+                return;
+
+            auto sum = T{};
+            for (auto v : w)
+            {
+                GEOMETRIX_ASSERT(v >= T{});
+                sum += v;
+            }
+
+            GEOMETRIX_ASSERT(sum > T{});
+            auto scale = static_cast<T>(n) / sum;
+            std::vector<std::uint32_t> small, large;
+            small.reserve(n);
+            large.reserve(n);
+            for (auto i = std::size_t{}; i < n; ++i)
+            {
+                w[i] *= scale;
+                if (w[i] < T(1))
+                    small.push_back(static_cast<std::uint32_t>(i));
+                else
+                    large.push_back(static_cast<std::uint32_t>(i));
+            }
+
+            while (!small.empty() && !large.empty())
+            {
+                auto s = small.back(); small.pop_back();
+                auto l = large.back();
+                m_prob[s] = w[s];
+                m_alias[s] = l;
+                w[l] = (w[l] + w[s]) - T(1);
+                if (w[l] < T(1))
+                {
+                    large.pop_back();
+                    small.push_back(l);
+                }
+            }
+
+            //! Anything left over is (up to rounding) exactly full.
+            for (auto i : large)
+            {
+                m_prob[i] = T(1);
+                m_alias[i] = i;
+            }
+
+            for (auto i : small)
+            {
+                m_prob[i] = T(1);
+                m_alias[i] = i;
+            }
+        }
+
+        std::vector<T>             m_prob;
+        std::vector<std::uint32_t> m_alias;
+
+    };
+
+}//! namespace stk;
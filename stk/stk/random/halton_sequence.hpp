@@ -0,0 +1,108 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef STK_HALTON_SEQUENCE_HPP
+#define STK_HALTON_SEQUENCE_HPP
+
+#if defined(_MSC_VER)
+    #pragma once
+#endif
+
+#include <stk/random/point_sequence_traits.hpp>
+#include <geometrix/utility/assert.hpp>
+#include <boost/config.hpp>
+#include <array>
+#include <limits>
+#include <cstdint>
+
+namespace stk {
+
+    //! Halton sequence yielding points in [0,1)^Dimension using the radical inverse of the index in the first Dimension prime bases.
+    //! Each point is a pure function of its index so seek/discard are O(1). Quality degrades in the higher dimensions (large bases) so
+    //! prefer sobol_sequence beyond a handful of dimensions.
+    template <std::size_t Dimension, typename T = double>
+    class halton_sequence
+    {
+        static_assert(Dimension > 0, "halton_sequence requires at least one dimension.");
+
+        static std::uint32_t get_prime(std::size_t d)
+        {
+            static const std::uint32_t primes[] = 
+            {
+                2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53,
+                59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131
+            };
+
+            static_assert(Dimension <= sizeof(primes) / sizeof(std::uint32_t), "halton_sequence bases are only tabulated for 32 dimensions.");
+            return primes[d];
+        }
+
+    public:
+
+        using category = point_sequence_tag;
+        using value_type = T;
+        using result_type = std::array<T, Dimension>;
+
+        //! The index starts at 1 by default as the 0th point is the origin in every dimension.
+        explicit halton_sequence(std::uint64_t start = 1)
+            : m_index(start)
+        {}
+
+        static BOOST_CONSTEXPR std::size_t dimension() { return Dimension; }
+
+        result_type operator()()
+        {
+            auto r = get(m_index);
+            ++m_index;
+            return r;
+        }
+
+        //! Evaluate the nth point directly.
+        static result_type get(std::uint64_t n)
+        {
+            result_type r;
+            for (std::size_t d = 0; d < Dimension; ++d)
+                r[d] = radical_inverse(n, get_prime(d));
+            return r;
+        }
+
+        void seek(std::uint64_t n) { m_index = n; }
+
+        void discard(unsigned long long n) { m_index += n; }
+
+        //! The index of the next point.
+        std::uint64_t position() const { return m_index; }
+
+    private:
+
+        static T radical_inverse(std::uint64_t n, std::uint32_t base)
+        {
+            //! Accumulate the reversed digits as an integer to keep the rounding to a single division.
+            const auto inv = T(1) / static_cast<T>(base);
+            auto reversed = std::uint64_t{};
+            auto invBaseN = T(1);
+            while (n)
+            {
+                auto next = n / base;
+                auto digit = n - next * base;
+                reversed = reversed * base + digit;
+                invBaseN *= inv;
+                n = next;
+            }
+
+            auto r = static_cast<T>(reversed) * invBaseN;
+            return r < T(1) ? r : T(1) - std::numeric_limits<T>::epsilon() / 2;
+        }
+
+        std::uint64_t m_index;
+
+    };
+
+}//! stk;
+
+#endif//! STK_HALTON_SEQUENCE_HPP
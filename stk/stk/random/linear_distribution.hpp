@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stk/utility/span.hpp>
 #include <geometrix/utility/assert.hpp>
 #include <geometrix/numeric/constants.hpp>
 #include <boost/math/distributions/normal.hpp>
@@ -104,6 +105,44 @@ namespace stk {
             return x0 + x * (x1 - x0);
         }
 
+        //! Fill the output with variates. The uniforms are drawn in bulk and the inverse cdf is applied in a separate branch free pass so it may be vectorized.
+        //! The result is the same sequence as successive calls to operator().
+        template<typename Engine>
+        void generate(Engine& e, stk::span<result_type> out)
+        {
+            generate(e, out, m_parameters);
+        }
+
+        template<typename Engine>
+        void generate(Engine& e, stk::span<result_type> out, const param_type& params)
+        {
+            using std::sqrt;
+
+            std::uniform_real_distribution<T> U;
+            for (auto& x : out)
+                x = U(e);
+
+            auto x0 = params.xmin();
+            auto dx = params.xmax() - x0;
+            auto y0 = params.ymin();
+            auto y1 = params.ymax();
+            auto n = out.size();
+            auto* px = out.data();
+            if (y0 != y1)
+            {
+                auto y02 = y0 * y0;
+                auto y12 = y1 * y1;
+                auto dy = y1 - y0;
+                for (std::size_t i = 0; i < n; ++i)
+                    px[i] = x0 + static_cast<T>((sqrt(y02 * (1.0 - px[i]) + y12 * px[i]) - y0) / dy) * dx;
+            }
+            else
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                    px[i] = x0 + px[i] * dx;
+            }
+        }
+
         template<typename CharT, typename Traits>
         std::basic_istream<CharT, Traits>& read(std::basic_istream<CharT, Traits>& str)
         {
@@ -119,10 +158,10 @@ namespace stk {
         template<typename CharT, typename Traits>
         std::basic_ostream<CharT, Traits>& write(std::basic_ostream<CharT, Traits>& str) const
         {
-            str << m_parameters.m_xmin;
-            str << m_parameters.m_xmax;
-            str << m_parameters.m_ymin;
-            str << m_parameters.m_ymax;
+            str << m_parameters.xmin() << " ";
+            str << m_parameters.xmax() << " ";
+            str << m_parameters.ymin() << " ";
+            str << m_parameters.ymax();
             return str;
         }
 
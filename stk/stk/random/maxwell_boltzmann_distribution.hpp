@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stk/utility/span.hpp>
 #include <geometrix/utility/assert.hpp>
 #include <geometrix/arithmetic/math_kernel.hpp>
 #include <random>
@@ -105,6 +106,53 @@ namespace stk {
             #endif
         }
 
+        //! Fill the output with variates. The exponential part of Johnk's algorithm is drawn in bulk for the whole batch and the final scaling is applied in
+        //! a separate pass so both may be vectorized. Only the rejection step runs per variate. The sequence differs from successive calls to operator().
+        template<typename Engine>
+        void generate(Engine& e, stk::span<result_type> out)
+        {
+            generate(e, out, m_parameters);
+        }
+
+        template<typename Engine>
+        void generate(Engine& e, stk::span<result_type> out, const param_type& params)
+        {
+            #ifdef STK_USE_NADER_BOLTZMANN_DISTRIBUTION
+            for (auto& x : out)
+                x = (*this)(e, params);
+            #else
+            auto U = std::uniform_real_distribution<T>();
+            for (auto& x : out)
+                x = U(e);
+
+            auto n = out.size();
+            auto* px = out.data();
+            for (std::size_t i = 0; i < n; ++i)
+                px[i] = -math_kernel::log(px[i]);
+
+            for (auto& r : out)
+            {
+                while (true)
+                {
+                    auto r1 = U(e);
+                    auto r2 = U(e);
+                    auto w1 = r1 * r1;
+                    auto w2 = r2 * r2;
+                    auto w = w1 + w2;
+                    if (w <= 1.0)
+                    {
+                        r = r - (w1 / w) * math_kernel::log(U(e));
+                        break;
+                    }
+                }
+            }
+
+            auto a = params.a();
+            for (std::size_t i = 0; i < n; ++i)
+                px[i] = a * math_kernel::sqrt(2.0 * px[i]);
+            #endif
+        }
+
         template<typename CharT, typename Traits>
         std::basic_istream<CharT, Traits>& read(std::basic_istream<CharT, Traits>& str)
         {
@@ -117,7 +165,7 @@ namespace stk {
         template<typename CharT, typename Traits>
         std::basic_ostream<CharT, Traits>& write(std::basic_ostream<CharT, Traits>& str) const
         {
-            str << m_parameters.m_a;
+            str << m_parameters.a();
             return str;
         }
 
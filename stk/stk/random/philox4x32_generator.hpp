@@ -0,0 +1,170 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+/*
+Philox4x32-10 from Parallel Random Numbers: As Easy as 1, 2, 3.
+John K. Salmon, Mark A. Moraes, Ron O. Dror, and David E. Shaw. SC11.
+*/
+#ifndef STK_PHILOX4X32_GENERATOR_HPP
+#define STK_PHILOX4X32_GENERATOR_HPP
+
+#if defined(_MSC_VER)
+    #pragma once
+#endif
+
+#include <geometrix/utility/assert.hpp>
+#include <boost/config.hpp>
+#include <array>
+#include <limits>
+#include <cstdint>
+
+namespace stk {
+
+    //! Counter-based generator. The output is a pure function of (key, counter) so any stream position can be reached in O(1) without storing state.
+    //! The 64 bit seed is the key and the counter is laid out as { block, tick, stream_lo, stream_hi }. This allows each (seed, stream, tick) triple
+    //! (e.g. (run seed, agent id, simulation tick)) to address an independent stream of 2^33 64-bit variates which can be regenerated at will independent
+    //! of thread scheduling.
+    class philox4x32_generator
+    {
+        static BOOST_CONSTEXPR std::uint32_t mulhilo(std::uint32_t a, std::uint32_t b, std::uint32_t& hi)
+        {
+            const auto p = static_cast<std::uint64_t>(a) * b;
+            hi = static_cast<std::uint32_t>(p >> 32);
+            return static_cast<std::uint32_t>(p);
+        }
+
+    public:
+
+        using result_type = std::uint64_t;
+        using counter_type = std::array<std::uint32_t, 4>;
+        using key_type = std::array<std::uint32_t, 2>;
+
+        static const std::uint64_t default_seed = 42ULL;
+        static const unsigned int  number_rounds = 10;
+
+        philox4x32_generator(std::uint64_t seed = default_seed, std::uint64_t stream = 0, std::uint32_t tick = 0)
+        {
+            this->seed(seed);
+            this->set_stream(stream, tick);
+        }
+
+        static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION (){ return 0; }
+        static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION (){ return (std::numeric_limits<result_type>::max)(); }
+
+        BOOST_FORCEINLINE result_type operator()()
+        {
+            if (m_index == 4)
+            {
+                m_output = apply(m_counter, m_key);
+                ++m_counter[0];
+                m_index = 0;
+            }
+
+            const auto r = (static_cast<std::uint64_t>(m_output[m_index]) << 32) | m_output[m_index + 1];
+            m_index += 2;
+            return r;
+        }
+
+        //! Set the key. The position is reset to the start of the current stream.
+        void seed(std::uint64_t seed = default_seed)
+        {
+            m_key[0] = static_cast<std::uint32_t>(seed);
+            m_key[1] = static_cast<std::uint32_t>(seed >> 32);
+            seek(0);
+        }
+
+        //! Select the stream addressed by (stream, tick) and reset the position to its start.
+        void set_stream(std::uint64_t stream, std::uint32_t tick = 0)
+        {
+            m_counter[1] = tick;
+            m_counter[2] = static_cast<std::uint32_t>(stream);
+            m_counter[3] = static_cast<std::uint32_t>(stream >> 32);
+            seek(0);
+        }
+
+        //! Move to the nth variate of the current stream in O(1).
+        void seek(std::uint64_t n)
+        {
+            GEOMETRIX_ASSERT(n / 2 <= (std::numeric_limits<std::uint32_t>::max)());
+            m_counter[0] = static_cast<std::uint32_t>(n / 2);
+            m_index = 4;
+            if (n % 2)
+            {
+                m_output = apply(m_counter, m_key);
+                ++m_counter[0];
+                m_index = 2;
+            }
+        }
+
+        //! Advance the generator by n steps in O(1).
+        void discard(unsigned long long n)
+        {
+            seek(position() + n);
+        }
+
+        //! The index of the next variate in the current stream.
+        std::uint64_t position() const
+        {
+            return m_index == 4 ? 2ULL * m_counter[0] : 2ULL * (m_counter[0] - 1) + m_index / 2;
+        }
+
+        const key_type&     key() const { return m_key; }
+        const counter_type& counter() const { return m_counter; }
+
+        //! The Philox4x32-10 bijection.
+        static counter_type apply(counter_type ctr, key_type key)
+        {
+            for (auto round = 0U; round < number_rounds; ++round)
+            {
+                if (round)
+                {
+                    key[0] += 0x9E3779B9;
+                    key[1] += 0xBB67AE85;
+                }
+
+                std::uint32_t hi0, hi1;
+                const auto lo0 = mulhilo(0xD2511F53, ctr[0], hi0);
+                const auto lo1 = mulhilo(0xCD9E8D57, ctr[2], hi1);
+                ctr = { hi1 ^ ctr[1] ^ key[0], lo1, hi0 ^ ctr[3] ^ key[1], lo0 };
+            }
+
+            return ctr;
+        }
+
+        //! Regenerate the nth variate of the stream addressed by (seed, stream, tick) without constructing a generator.
+        static result_type generate(std::uint64_t seed, std::uint64_t stream, std::uint32_t tick, std::uint64_t n)
+        {
+            GEOMETRIX_ASSERT(n / 2 <= (std::numeric_limits<std::uint32_t>::max)());
+            const auto r = apply({ static_cast<std::uint32_t>(n / 2), tick, static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32) }, { static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32) });
+            const auto i = (n % 2) * 2;
+            return (static_cast<std::uint64_t>(r[i]) << 32) | r[i + 1];
+        }
+
+        friend bool operator ==(const philox4x32_generator& lhs, const philox4x32_generator& rhs)
+        {
+            return lhs.m_key == rhs.m_key && lhs.position() == rhs.position() && lhs.m_counter[1] == rhs.m_counter[1] && lhs.m_counter[2] == rhs.m_counter[2] && lhs.m_counter[3] == rhs.m_counter[3];
+        }
+
+        friend bool operator !=(const philox4x32_generator& lhs, const philox4x32_generator& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+
+        key_type      m_key;
+        counter_type  m_counter;
+        counter_type  m_output;
+        unsigned int  m_index{4};
+
+    };
+
+}//! stk;
+
+#endif//! STK_PHILOX4X32_GENERATOR_HPP
@@ -0,0 +1,24 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include <type_traits>
+
+namespace stk {
+
+    //! Tag declared by generators which yield points in [0,1)^d rather than scalar random bits (e.g. sobol_sequence, halton_sequence, r2_sequence.)
+    struct point_sequence_tag {};
+
+    template <typename T, typename Enable = void>
+    struct is_point_sequence : std::false_type {};
+
+    template <typename T>
+    struct is_point_sequence<T, typename std::enable_if<std::is_same<typename T::category, point_sequence_tag>::value>::type> : std::true_type {};
+
+}//! namespace stk;
@@ -0,0 +1,121 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+/*
+The R_d additive recurrence from
+M. Roberts, The Unreasonable Effectiveness of Quasirandom Sequences, 2018.
+*/
+#ifndef STK_R2_SEQUENCE_HPP
+#define STK_R2_SEQUENCE_HPP
+
+#if defined(_MSC_VER)
+    #pragma once
+#endif
+
+#include <stk/random/point_sequence_traits.hpp>
+#include <geometrix/utility/assert.hpp>
+#include <boost/config.hpp>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <cstdint>
+
+namespace stk {
+
+    //! Additive recurrence x_n = frac(offset + n * alpha) where alpha_i = phi_d^-i and phi_d is the unique positive root of x^(d+1) = x + 1.
+    //! (For Dimension == 2 this is the R2 sequence.) The recurrence is carried in 64 bit fixed point so the points do not lose precision as n grows
+    //! and seek/discard are O(Dimension).
+    template <std::size_t Dimension, typename T = double>
+    class r2_sequence
+    {
+        static_assert(Dimension > 0, "r2_sequence requires at least one dimension.");
+
+    public:
+
+        using category = point_sequence_tag;
+        using value_type = T;
+        using result_type = std::array<T, Dimension>;
+
+        //! The offset is a shift applied in every dimension. Different offsets give randomized (Cranley-Patterson rotated) replicates.
+        explicit r2_sequence(double offset = 0.5)
+        {
+            //! Newton's method for phi_d.
+            auto phi = 2.0;
+            for (auto i = 0; i < 64; ++i)
+            {
+                auto f = std::pow(phi, static_cast<double>(Dimension + 1)) - phi - 1.0;
+                auto df = static_cast<double>(Dimension + 1) * std::pow(phi, static_cast<double>(Dimension)) - 1.0;
+                auto next = phi - f / df;
+                if (next == phi)
+                    break;
+                phi = next;
+            }
+
+            auto a = 1.0;
+            for (std::size_t d = 0; d < Dimension; ++d)
+            {
+                a /= phi;
+                m_alpha[d] = to_fixed(a);
+            }
+
+            GEOMETRIX_ASSERT(offset >= 0.0 && offset < 1.0);
+            m_offset = to_fixed(offset);
+            seek(0);
+        }
+
+        static BOOST_CONSTEXPR std::size_t dimension() { return Dimension; }
+
+        result_type operator()()
+        {
+            result_type r;
+            for (std::size_t d = 0; d < Dimension; ++d)
+            {
+                r[d] = to_unit(m_state[d]);
+                m_state[d] += m_alpha[d];
+            }
+            ++m_index;
+            return r;
+        }
+
+        void seek(std::uint64_t n)
+        {
+            m_index = n;
+            for (std::size_t d = 0; d < Dimension; ++d)
+                m_state[d] = m_offset + n * m_alpha[d];//! Wraps modulo 2^64 which is frac() in fixed point.
+        }
+
+        void discard(unsigned long long n) { seek(m_index + n); }
+
+        //! The index of the next point.
+        std::uint64_t position() const { return m_index; }
+
+    private:
+
+        static std::uint64_t to_fixed(double x)
+        {
+            return static_cast<std::uint64_t>(std::ldexp(x, 64));
+        }
+
+        //! Keep only as many bits as T can represent so the result is strictly less than 1.
+        static T to_unit(std::uint64_t x)
+        {
+            BOOST_STATIC_CONSTEXPR int shift = std::numeric_limits<T>::digits < 64 ? 64 - std::numeric_limits<T>::digits : 0;
+            return static_cast<T>(x >> shift) * static_cast<T>(std::ldexp(1.0, shift - 64));
+        }
+
+        std::array<std::uint64_t, Dimension> m_alpha;
+        std::array<std::uint64_t, Dimension> m_state;
+        std::uint64_t                        m_offset;
+        std::uint64_t                        m_index{ 0 };
+
+    };
+
+}//! stk;
+
+#endif//! STK_R2_SEQUENCE_HPP
@@ -0,0 +1,237 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+//
+/*
+Direction numbers are the first rows of new-joe-kuo-6.21201 from
+S. Joe and F. Y. Kuo, Constructing Sobol sequences with better two-dimensional projections, SIAM J. Sci. Comput. 30, 2635-2654 (2008).
+
+Scrambling uses the hash based nested uniform (Owen) scramble from
+B. Burley, Practical Hash-based Owen Scrambling, Journal of Computer Graphics Techniques 9(4), 2020.
+*/
+#ifndef STK_SOBOL_SEQUENCE_HPP
+#define STK_SOBOL_SEQUENCE_HPP
+
+#if defined(_MSC_VER)
+    #pragma once
+#endif
+
+#include <stk/random/point_sequence_traits.hpp>
+#include <geometrix/utility/assert.hpp>
+#include <boost/config.hpp>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <cstdint>
+
+namespace stk {
+
+    namespace detail {
+
+        inline std::uint32_t reverse_bits(std::uint32_t x)
+        {
+            x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+            x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+            x = ((x >> 4) & 0x0F0F0F0Fu) | ((x & 0x0F0F0F0Fu) << 4);
+            x = ((x >> 8) & 0x00FF00FFu) | ((x & 0x00FF00FFu) << 8);
+            return (x >> 16) | (x << 16);
+        }
+
+        //! Index of the lowest zero bit.
+        inline unsigned int lowest_zero_bit(std::uint32_t x)
+        {
+            auto c = 0U;
+            while (x & 1U)
+            {
+                x >>= 1;
+                ++c;
+            }
+            return c;
+        }
+
+        inline std::uint32_t hash_combine_u32(std::uint32_t seed, std::uint32_t v)
+        {
+            return seed ^ (v + 0x9e3779b9u + (seed << 6) + (seed >> 2));
+        }
+
+        //! Nested uniform scramble of a 32 bit fixed point fraction. Each bit is flipped based on a hash of the more significant bits which preserves the net properties of the sequence.
+        inline std::uint32_t owen_scramble(std::uint32_t x, std::uint32_t seed)
+        {
+            x = reverse_bits(x);
+            x += seed;
+            x ^= x * 0x6c50b47cu;
+            x ^= x * 0xb82f1e52u;
+            x ^= x * 0xc7afe638u;
+            x ^= x * 0x8d22f6e6u;
+            return reverse_bits(x);
+        }
+
+    }//! namespace detail;
+
+    //! Sobol sequence yielding points in [0,1)^Dimension in Gray code order. Up to 2^32 points may be drawn.
+    //! When constructed with a scramble seed the points are Owen scrambled (independently per dimension) so that independent seeds give
+    //! independent randomized QMC replicates suitable for error estimates.
+    //! seek/discard are O(Dimension * 32) so work may be partitioned across threads by giving each worker a disjoint index range.
+    template <std::size_t Dimension, typename T = double>
+    class sobol_sequence
+    {
+        static_assert(Dimension > 0, "sobol_sequence requires at least one dimension.");
+
+        struct direction_entry
+        {
+            unsigned int  degree;
+            std::uint32_t a;
+            std::uint32_t m[7];
+        };
+
+        static const direction_entry& get_direction_entry(std::size_t d)
+        {
+            //! Dimension 0 is the van der Corput sequence and has no entry.
+            static const direction_entry table[] =
+            {
+                  { 1, 0, { 1 } }
+                , { 2, 1, { 1, 3 } }
+                , { 3, 1, { 1, 3, 1 } }
+                , { 3, 2, { 1, 1, 1 } }
+                , { 4, 1, { 1, 1, 3, 3 } }
+                , { 4, 4, { 1, 3, 5, 13 } }
+                , { 5, 2, { 1, 1, 5, 5, 17 } }
+                , { 5, 4, { 1, 1, 5, 5, 5 } }
+                , { 5, 7, { 1, 1, 7, 11, 19 } }
+                , { 5, 11, { 1, 1, 5, 1, 1 } }
+                , { 5, 13, { 1, 1, 1, 3, 11 } }
+                , { 5, 14, { 1, 3, 5, 5, 31 } }
+                , { 6, 1, { 1, 3, 3, 9, 7, 49 } }
+                , { 6, 13, { 1, 1, 1, 15, 21, 21 } }
+                , { 6, 16, { 1, 3, 1, 13, 27, 49 } }
+                , { 6, 19, { 1, 1, 1, 15, 7, 5 } }
+                , { 6, 22, { 1, 3, 1, 15, 13, 25 } }
+                , { 6, 25, { 1, 1, 5, 5, 19, 61 } }
+                , { 7, 1, { 1, 3, 7, 11, 23, 15, 103 } }
+                , { 7, 4, { 1, 3, 7, 13, 13, 15, 69 } }
+            };
+
+            static_assert(Dimension <= sizeof(table) / sizeof(direction_entry) + 1, "sobol_sequence direction numbers are only tabulated for 21 dimensions.");
+            GEOMETRIX_ASSERT(d > 0);
+            return table[d - 1];
+        }
+
+    public:
+
+        using category = point_sequence_tag;
+        using value_type = T;
+        using result_type = std::array<T, Dimension>;
+
+        BOOST_STATIC_CONSTEXPR std::uint32_t bits = 32;
+
+        //! A zero scramble seed yields the unscrambled sequence.
+        explicit sobol_sequence(std::uint32_t scrambleSeed = 0)
+        {
+            init_directions();
+            seed(scrambleSeed);
+        }
+
+        static BOOST_CONSTEXPR std::size_t dimension() { return Dimension; }
+
+        //! Reset the sequence with a new scramble. The position is reset to the start.
+        void seed(std::uint32_t scrambleSeed)
+        {
+            m_scrambled = scrambleSeed != 0;
+            auto h = scrambleSeed;
+            for (std::size_t d = 0; d < Dimension; ++d)
+            {
+                h = detail::hash_combine_u32(h, static_cast<std::uint32_t>(d) * 0x85ebca6bu);
+                m_scramble[d] = h;
+            }
+
+            seek(0);
+        }
+
+        result_type operator()()
+        {
+            GEOMETRIX_ASSERT(m_index <= (std::numeric_limits<std::uint32_t>::max)());
+            result_type r;
+            for (std::size_t d = 0; d < Dimension; ++d)
+                r[d] = to_unit(m_scrambled ? detail::owen_scramble(m_state[d], m_scramble[d]) : m_state[d]);
+
+            //! Gray code update: the next point differs in the direction of the lowest zero bit of the current index.
+            auto c = detail::lowest_zero_bit(static_cast<std::uint32_t>(m_index));
+            if (c < bits)
+                for (std::size_t d = 0; d < Dimension; ++d)
+                    m_state[d] ^= m_directions[d][c];
+            ++m_index;
+            return r;
+        }
+
+        //! Move to the nth point.
+        void seek(std::uint64_t n)
+        {
+            GEOMETRIX_ASSERT(n <= (std::numeric_limits<std::uint32_t>::max)());
+            m_index = n;
+            auto g = static_cast<std::uint32_t>(n ^ (n >> 1));
+            for (std::size_t d = 0; d < Dimension; ++d)
+            {
+                auto x = std::uint32_t{};
+                for (auto b = 0U; b < bits; ++b)
+                    if (g & (std::uint32_t{ 1 } << b))
+                        x ^= m_directions[d][b];
+                m_state[d] = x;
+            }
+        }
+
+        void discard(unsigned long long n)
+        {
+            seek(m_index + n);
+        }
+
+        //! The index of the next point.
+        std::uint64_t position() const { return m_index; }
+
+    private:
+
+        //! Keep only as many bits as T can represent so the result is strictly less than 1.
+        static T to_unit(std::uint32_t x)
+        {
+            BOOST_STATIC_CONSTEXPR int shift = std::numeric_limits<T>::digits < 32 ? 32 - std::numeric_limits<T>::digits : 0;
+            return static_cast<T>(x >> shift) * static_cast<T>(std::ldexp(1.0, shift - 32));
+        }
+
+        void init_directions()
+        {
+            for (auto b = 0U; b < bits; ++b)
+                m_directions[0][b] = std::uint32_t{ 1 } << (bits - 1 - b);
+
+            for (std::size_t d = 1; d < Dimension; ++d)
+            {
+                const auto& e = get_direction_entry(d);
+                auto s = e.degree;
+                auto& v = m_directions[d];
+                for (auto b = 0U; b < s && b < bits; ++b)
+                    v[b] = e.m[b] << (bits - 1 - b);
+
+                for (auto b = s; b < bits; ++b)
+                {
+                    v[b] = v[b - s] ^ (v[b - s] >> s);
+                    for (auto k = 1U; k < s; ++k)
+                        if ((e.a >> (s - 1 - k)) & 1U)
+                            v[b] ^= v[b - k];
+                }
+            }
+        }
+
+        std::array<std::array<std::uint32_t, bits>, Dimension> m_directions;
+        std::array<std::uint32_t, Dimension>                    m_state;
+        std::array<std::uint32_t, Dimension>                    m_scramble;
+        std::uint64_t                                           m_index{ 0 };
+        bool                                                    m_scrambled{ false };
+
+    };
+
+}//! stk;
+
+#endif//! STK_SOBOL_SEQUENCE_HPP
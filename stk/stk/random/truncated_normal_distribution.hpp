@@ -1,16 +1,263 @@
 #pragma once
 
+#include <stk/random/alias_table.hpp>
+#include <stk/utility/span.hpp>
 #include <geometrix/utility/assert.hpp>
 #include <geometrix/numeric/constants.hpp>
 #include <boost/math/distributions/normal.hpp>
 #include <boost/random/uniform_real_distribution.hpp>
+#include <array>
 #include <random>
 #include <cmath>
+#include <memory>
 #include <istream>
 #include <ostream>
 
 namespace stk {
 
+    namespace detail {
+
+        //! Exact sampler for the standard normal truncated to [a, b] (from Simulation from the Normal Distribution Truncated to an Interval in the Tail, Botev and L'Ecuyer,
+        //! and Fast simulation of truncated Gaussian distributions, Chopin). All setup is done on construction so that it may be cached per parameter set.
+        //! The method is chosen by truncation region:
+        //!     uniform     - the density is nearly flat over [a, b]; uniform proposal with a squeeze.
+        //!     exponential - [a, b] lies in the tail beyond tail_cutoff; Robert's exponential proposal with the optimal rate.
+        //!     table       - Chopin style strips of piecewise constant envelopes over [max(a, -c), min(b, c)] with exponential envelopes for any tails beyond c.
+        //!                   The strip (or tail) is selected in O(1) from an alias table over the envelope areas.
+        template <typename T>
+        class truncated_normal_sampler
+        {
+        public:
+
+            enum class method : std::uint8_t
+            {
+                uniform
+              , exponential
+              , table
+            };
+
+            BOOST_STATIC_CONSTEXPR std::size_t number_strips = 128;
+
+            //! Bounds of the table region. Beyond this use an exponential envelope.
+            static T tail_cutoff() { return static_cast<T>(3.5); }
+
+            //! Use uniform rejection when the density varies by less than this ratio over [a, b].
+            static T uniform_ratio() { return static_cast<T>(0.6); }
+
+            truncated_normal_sampler(T a, T b)
+            {
+                using std::exp;
+                using std::sqrt;
+                GEOMETRIX_ASSERT(a < b);
+
+                //! Reflect so the interval always has some positive support.
+                if (b <= T{})
+                {
+                    auto t = a;
+                    a = -b;
+                    b = -t;
+                    m_sign = T(-1);
+                }
+
+                m_a = a;
+                m_b = b;
+
+                //! The mode of the truncated density and the ratio of the min/max density over [a, b].
+                m_mode = (std::max)(a, T{});
+                m_ratio = a > T{} ? exp(-(b - a) * (b + a) * T(0.5)) : exp(-(std::max)(a * a, b * b) * T(0.5));
+                if (m_ratio >= uniform_ratio())
+                {
+                    m_method = method::uniform;
+                    return;
+                }
+
+                auto c = tail_cutoff();
+                if (a >= c)
+                {
+                    m_method = method::exponential;
+                    m_lambda = T(0.5) * (a + sqrt(a * a + T(4)));
+                    m_q = -std::expm1(-m_lambda * (b - a));
+                    return;
+                }
+
+                m_method = method::table;
+                generate_table();
+            }
+
+            method get_method() const { return m_method; }
+
+            template <typename Engine>
+            T operator()(Engine& e) const
+            {
+                switch (m_method)
+                {
+                case method::uniform:
+                    return m_sign * uniform(e);
+                case method::exponential:
+                    return m_sign * exponential(e);
+                default:
+                    return m_sign * table(e);
+                }
+            }
+
+            //! Fill the output with variates hoisting the method dispatch out of the loop.
+            template <typename Engine>
+            void generate(Engine& e, stk::span<T> out) const
+            {
+                switch (m_method)
+                {
+                case method::uniform:
+                    for (auto& x : out)
+                        x = uniform(e);
+                    break;
+                case method::exponential:
+                    for (auto& x : out)
+                        x = exponential(e);
+                    break;
+                default:
+                    for (auto& x : out)
+                        x = table(e);
+                    break;
+                }
+
+                if (m_sign < T{})
+                {
+                    auto n = out.size();
+                    auto* px = out.data();
+                    for (std::size_t i = 0; i < n; ++i)
+                        px[i] = -px[i];
+                }
+            }
+
+        private:
+
+            template <typename Engine>
+            T uniform(Engine& e) const
+            {
+                using std::exp;
+                boost::random::uniform_real_distribution<T> U;
+                auto w = m_b - m_a;
+                while (true)
+                {
+                    auto x = m_a + w * U(e);
+                    auto v = U(e);
+                    if (v <= m_ratio || v <= exp(-(x - m_mode) * (x + m_mode) * T(0.5)))
+                        return x;
+                }
+            }
+
+            template <typename Engine>
+            T exponential(Engine& e) const
+            {
+                using std::exp;
+                using std::log1p;
+                boost::random::uniform_real_distribution<T> U;
+                while (true)
+                {
+                    auto x = m_a - log1p(-m_q * U(e)) / m_lambda;
+                    auto d = x - m_lambda;
+                    if (U(e) <= exp(-d * d * T(0.5)))
+                        return x;
+                }
+            }
+
+            template <typename Engine>
+            T table(Engine& e) const
+            {
+                using std::exp;
+                using std::log1p;
+                boost::random::uniform_real_distribution<T> U;
+                while (true)
+                {
+                    auto i = m_alias(U(e));
+                    if (BOOST_LIKELY(i < number_strips))
+                    {
+                        auto x = m_x0 + (static_cast<T>(i) + U(e)) * m_h;
+                        const auto& s = m_strips[i];
+                        auto y = U(e) * s.ymax;
+                        if (y <= s.ymin || y <= exp(-x * x * T(0.5)))
+                            return x;
+                    }
+                    else
+                    {
+                        //! Exponential envelope exp(-c^2/2 - c(x - c)) over the tail beyond c. The left tail is sampled as a reflected right tail.
+                        auto c = tail_cutoff();
+                        auto isRight = i == number_strips;
+                        auto q = isRight ? m_qRight : m_qLeft;
+                        auto x = c - log1p(-q * U(e)) / c;
+                        auto d = x - c;
+                        if (U(e) <= exp(-d * d * T(0.5)))
+                            return isRight ? x : -x;
+                    }
+                }
+            }
+
+            void generate_table()
+            {
+                using std::exp;
+                using std::expm1;
+
+                auto c = tail_cutoff();
+                auto lo = (std::max)(m_a, -c);
+                auto hi = (std::min)(m_b, c);
+                GEOMETRIX_ASSERT(lo < hi);
+                m_x0 = lo;
+                m_h = (hi - lo) / static_cast<T>(number_strips);
+
+                std::vector<T> areas(number_strips + 2, T{});
+                for (auto i = std::size_t{}; i < number_strips; ++i)
+                {
+                    auto x0 = lo + static_cast<T>(i) * m_h;
+                    auto x1 = x0 + m_h;
+                    auto xnear = (x0 <= T{} && x1 >= T{}) ? T{} : (std::min)(std::abs(x0), std::abs(x1));
+                    auto xfar = (std::max)(std::abs(x0), std::abs(x1));
+                    m_strips[i].ymax = exp(-xnear * xnear * T(0.5));
+                    m_strips[i].ymin = exp(-xfar * xfar * T(0.5));
+                    areas[i] = m_h * m_strips[i].ymax;
+                }
+
+                //! Envelope mass of the tail pieces: exp(-c^2/2) * q / c.
+                auto yc = exp(-c * c * T(0.5));
+                if (m_b > c)
+                {
+                    m_qRight = -expm1(-c * (m_b - c));
+                    areas[number_strips] = yc * m_qRight / c;
+                }
+
+                if (m_a < -c)
+                {
+                    m_qLeft = -expm1(-c * (-c - m_a));
+                    areas[number_strips + 1] = yc * m_qLeft / c;
+                }
+
+                m_alias = alias_table<T>(areas);
+            }
+
+            struct strip
+            {
+                T ymax;
+                T ymin;
+            };
+
+            method                           m_method{ method::table };
+            T                                m_sign{ 1 };
+            T                                m_a;
+            T                                m_b;
+            T                                m_mode;
+            T                                m_ratio;
+            T                                m_lambda{};
+            T                                m_q{};
+            T                                m_x0{};
+            T                                m_h{};
+            T                                m_qRight{};
+            T                                m_qLeft{};
+            std::array<strip, number_strips> m_strips;
+            alias_table<T>                   m_alias;
+
+        };
+
+    }//! namespace detail;
+
     template<typename T = double>
 	class truncated_normal_distribution
 	{	
@@ -32,11 +279,12 @@ namespace stk {
                 boost::math::normal_distribution<T> dist(mean, sigma);
                 m_min_quantile = boost::math::cdf(dist, m_min);
                 m_max_quantile = boost::math::cdf(dist, m_max);
+                m_sampler = std::make_shared<detail::truncated_normal_sampler<T>>(standard_normal_lower(), standard_normal_upper());
             }
 
 			bool operator ==(const param_type& rhs) const
             {	
-                return m_mean == rhs.m_mean && m_sigma == rhs.m_sigma;
+                return m_mean == rhs.m_mean && m_sigma == rhs.m_sigma && m_min == rhs.m_min && m_max == rhs.m_max;
             }
 
             bool operator !=(const param_type& right) const
@@ -56,6 +304,9 @@ namespace stk {
             T standard_normal_lower() const { return scale_to_standard_normal(m_min, m_mean, m_sigma); }
             T standard_normal_upper() const { return scale_to_standard_normal(m_max, m_mean, m_sigma); }
 
+            //! The precomputed sampler over the standard normal bounds.
+            const detail::truncated_normal_sampler<T>& sampler() const { return *m_sampler; }
+
         private:
 
 			static bool is_standard_normal(T m, T s)
@@ -80,6 +331,7 @@ namespace stk {
             T m_max;
             T m_min_quantile;
             T m_max_quantile;
+            std::shared_ptr<const detail::truncated_normal_sampler<T>> m_sampler;
 
 		};
 
@@ -121,15 +373,34 @@ namespace stk {
 	    template<typename Engine>
 		result_type operator()(Engine& e, const param_type& params)
 		{
-            boost::random::uniform_real_distribution<T> U(params.lower_quantile(), params.upper_quantile());
-            auto u = U(e);
-			boost::math::normal_distribution<T> dist;
-            auto r = boost::math::quantile(dist, u);
-			if (m_parameters.is_standard_normal())
+            auto r = params.sampler()(e);
+			if (params.is_standard_normal())
 				return r;
 			return params.scale_to_general(r);
 		}
 
+        //! Fill the output with variates. The sampler is dispatched once per batch and the scaling to the general normal is applied in a separate pass.
+        template<typename Engine>
+        void generate(Engine& e, stk::span<result_type> out)
+        {
+            generate(e, out, m_parameters);
+        }
+
+        template<typename Engine>
+        void generate(Engine& e, stk::span<result_type> out, const param_type& params)
+        {
+            params.sampler().generate(e, out);
+            if (params.is_standard_normal())
+                return;
+
+            auto m = params.mean();
+            auto sigma = params.sigma();
+            auto n = out.size();
+            auto* px = out.data();
+            for (std::size_t i = 0; i < n; ++i)
+                px[i] = px[i] * sigma + m;
+        }
+
 	    template<typename CharT, typename Traits>
 		std::basic_istream<CharT, Traits>& read(std::basic_istream<CharT, Traits>& str)
 		{
@@ -147,10 +418,10 @@ namespace stk {
 	    template<typename CharT, typename Traits>
 		std::basic_ostream<CharT, Traits>& write(std::basic_ostream<CharT, Traits>& str) const
 		{
-            str << m_parameters.m_mean;
-            str << m_parameters.m_sigma;
-            str << m_parameters.m_min;
-            str << m_parameters.m_max;
+            str << m_parameters.mean() << " ";
+            str << m_parameters.sigma() << " ";
+            str << m_parameters.lower() << " ";
+            str << m_parameters.upper();
 		    return str;
 		}
 
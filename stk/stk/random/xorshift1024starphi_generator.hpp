@@ -84,8 +84,58 @@ namespace stk {
             m_state[15] = reinterpret_cast<std::uint64_t*>(temp)[15];
         }
 
+        //! Advance the generator 2^512 steps. Equivalent to 2^512 calls to operator(). Used to partition the period into 2^512 non-overlapping streams for parallel computations.
+        void jump()
+        {
+            static const std::uint64_t JUMP[] = {
+                0x84242f96eca9c41dULL, 0xa3c65b8776f96855ULL, 0x5b34a39f070b5837ULL, 0x4489affce4f31a1eULL,
+                0x2ffeeb0a48316f40ULL, 0xdc2d9891fe68c022ULL, 0x3659132bb12fea70ULL, 0xaac17d8efa43cab8ULL,
+                0xc4cb815590989b13ULL, 0x5ee975283d71c93bULL, 0x691548c86c1bd540ULL, 0x7910c41d10a1e6a5ULL,
+                0x0b5fc64563b3e2a8ULL, 0x047f7684e9fc949dULL, 0xb99181f2d8f685caULL, 0x284600e3f30e38c3ULL
+            };
+            jump_impl(JUMP);
+        }
+
+        //! Advance the generator 2^768 steps. Used to generate 2^256 starting points from each of which jump() will generate 2^256 non-overlapping streams.
+        void long_jump()
+        {
+            static const std::uint64_t LONG_JUMP[] = {
+                0x1db6ba0415e68f80ULL, 0x1f09c81ae9ac14e7ULL, 0x1f6719a6ee34e7f3ULL, 0xc120593b38a9b5eaULL,
+                0x3c412a1d4223ae9aULL, 0x8048b2a10ba2f726ULL, 0x88e5362f50f7f650ULL, 0x891fa8984bfc0276ULL,
+                0xa19d44b0dd77a638ULL, 0xac0ab6e69c4da928ULL, 0x46719fb5c5c827b7ULL, 0x05dd7bf153461782ULL,
+                0x56a51dd185004647ULL, 0x59b2257befdad3d3ULL, 0xd5d8a614c24b08b3ULL, 0xd0159f547fca0a39ULL
+            };
+            jump_impl(LONG_JUMP);
+        }
+
+        //! Advance the generator by n steps.
+        void discard(unsigned long long n)
+        {
+            for (; n > 0; --n)
+                (*this)();
+        }
+
     private:
 
+        //! The jump polynomials are x^(2^k) mod the characteristic polynomial of the generator.
+        void jump_impl(const std::uint64_t (&poly)[16])
+        {
+            std::array<std::uint64_t, 16> t = {};
+            for (auto word : poly)
+            {
+                for (auto b = 0; b < 64; ++b)
+                {
+                    if (word & (std::uint64_t{ 1 } << b))
+                        for (auto j = 0U; j < 16; ++j)
+                            t[j] ^= m_state[(j + m_index) & 15];
+                    (*this)();
+                }
+            }
+
+            for (auto j = 0U; j < 16; ++j)
+                m_state[(j + m_index) & 15] = t[j];
+        }
+
         std::array<std::uint64_t, 16> m_state;
         unsigned int m_index{0};
 
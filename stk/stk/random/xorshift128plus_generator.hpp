@@ -49,7 +49,7 @@ namespace stk {
         static BOOST_CONSTEXPR result_type min(){ return 0; }
         static BOOST_CONSTEXPR result_type max(){ return (std::numeric_limits<result_type>::max)(); }
 
-        BOOST_FORCEINLINE result_type operator()
+        BOOST_FORCEINLINE result_type operator()()
         {
             auto s1 = m_state[0];
             const auto s0 = m_state[1];
@@ -70,7 +70,50 @@ namespace stk {
             m_state[1] = reinterpret_cast<std::uint64_t*>(temp)[1];
         }
 
+        //! Advance the generator 2^64 steps. Equivalent to 2^64 calls to operator(). Used to partition the period into 2^64 non-overlapping streams for parallel computations.
+        void jump()
+        {
+            static const std::uint64_t JUMP[] = { 0x8a5cd789635d2dffULL, 0x121fd2155c472f96ULL };
+            jump_impl(JUMP);
+        }
+
+        //! Advance the generator 2^96 steps. Used to generate 2^32 starting points from each of which jump() will generate 2^32 non-overlapping streams.
+        void long_jump()
+        {
+            static const std::uint64_t LONG_JUMP[] = { 0xea61c9f1f13962aeULL, 0xa1fe50ef79cfafb2ULL };
+            jump_impl(LONG_JUMP);
+        }
+
+        //! Advance the generator by n steps.
+        void discard(unsigned long long n)
+        {
+            for (; n > 0; --n)
+                (*this)();
+        }
+
     private:
+
+        //! The jump polynomials are x^(2^k) mod the characteristic polynomial of the generator.
+        void jump_impl(const std::uint64_t (&poly)[2])
+        {
+            std::uint64_t s0 = 0;
+            std::uint64_t s1 = 0;
+            for (auto word : poly)
+            {
+                for (auto b = 0; b < 64; ++b)
+                {
+                    if (word & (std::uint64_t{ 1 } << b))
+                    {
+                        s0 ^= m_state[0];
+                        s1 ^= m_state[1];
+                    }
+                    (*this)();
+                }
+            }
+
+            m_state[0] = s0;
+            m_state[1] = s1;
+        }
     
         std::array<std::uint64_t, 2> m_state;
     };
@@ -1,36 +1,91 @@
 #pragma once
 
+#include <stk/math/math.hpp>
+#include <stk/utility/span.hpp>
 #include <geometrix/utility/assert.hpp>
 #include <geometrix/numeric/constants.hpp>
-#include <boost/math/distributions/poisson.hpp>
-#include <boost/random/poisson_distribution.hpp>
 #include <boost/random/uniform_real_distribution.hpp>
+#include <boost/config.hpp>
 #include <random>
 #include <cmath>
+#include <vector>
+#include <limits>
+#include <cstdint>
 #include <istream>
 #include <ostream>
 
 namespace stk {
 
+    namespace detail {
+
+        //! log(k!) evaluated with stk::log so results are reproducible across platforms.
+        template <typename T>
+        inline T log_factorial(std::uint64_t k)
+        {
+            static const T table[] = {
+                  T(0.0)
+                , T(0.0)
+                , T(0.69314718055994530942)
+                , T(1.79175946922805500081)
+                , T(3.17805383034794561965)
+                , T(4.78749174278204599425)
+                , T(6.57925121201010099506)
+                , T(8.52516136106541430017)
+                , T(10.6046029027452502284)
+                , T(12.8018274800814696112)
+                , T(15.1044125730755152952)
+            };
+
+            if (k < sizeof(table) / sizeof(T))
+                return table[k];
+
+            //! Stirling series; the truncation error is below 1e-13 for k > 10.
+            auto n = static_cast<T>(k);
+            auto inv = T(1) / n;
+            auto inv2 = inv * inv;
+            return (n + T(0.5)) * stk::log(n) - n + T(0.91893853320467274178) + inv * (T(1.0 / 12.0) - inv2 * (T(1.0 / 360.0) - inv2 * T(1.0 / 1260.0)));
+        }
+
+        //! 1 - exp(-x) without the cancellation for small x.
+        template <typename T>
+        inline T one_minus_exp_neg(T x)
+        {
+            if (x < T(0.01))
+                return x * (T(1) - x / T(2) * (T(1) - x / T(3) * (T(1) - x / T(4) * (T(1) - x / T(5)))));
+            return T(1) - stk::exp(-x);
+        }
+
+    }//! namespace detail;
+
+    //! Poisson distribution conditioned on k > 0. All setup is computed once per param_type:
+    //!     mean < inversion_limit - Sequential search over a precomputed cdf table of the truncated pmf (extended by recurrence for u beyond the table.)
+    //!     otherwise              - Hormann's transformed rejection with squeeze (PTRS) rejecting k == 0.
+    //! Transcendental functions are evaluated with stk::math for cross-platform determinism.
     template<typename ResultType = int, typename T = double>
 	class zero_truncated_poisson_distribution
-	{	
+	{
     public:
-	    
+
 		using result_type = ResultType;
 
+        static T inversion_limit() { return T(10); }
+
 	    struct param_type
 		{
-            using distribution_type = zero_truncated_poisson_distribution<T>;
+            using distribution_type = zero_truncated_poisson_distribution<ResultType, T>;
 
             explicit param_type(T mean)
                 : m_mean(mean)
             {
 				GEOMETRIX_ASSERT(mean > 0.0);
+                if (m_mean < inversion_limit())
+                    init_inversion();
+                else
+                    init_ptrs();
             }
 
 			bool operator ==(const param_type& rhs) const
-            {	
+            {
                 return m_mean == rhs.m_mean;
             }
 
@@ -41,10 +96,55 @@ namespace stk {
 
             T mean() const { return m_mean; }
 
+            bool use_inversion() const { return !m_cdf.empty(); }
+
         private:
 
+            friend class zero_truncated_poisson_distribution;
+
+            void init_inversion()
+            {
+                //! P(k) = exp(-mean) mean^k / (k! (1 - exp(-mean))) for k >= 1.
+                auto p = m_mean * stk::exp(-m_mean) / detail::one_minus_exp_neg(m_mean);
+                auto F = p;
+                auto k = std::uint64_t{ 1 };
+                m_cdf.push_back(F);
+                while (F < T(1) && p > std::numeric_limits<T>::epsilon() * F && k < max_table_size)
+                {
+                    p *= m_mean / static_cast<T>(++k);
+                    F += p;
+                    m_cdf.push_back(F);
+                }
+
+                m_tail_pmf = p;
+            }
+
+            void init_ptrs()
+            {
+                m_smu = stk::sqrt(m_mean);
+                m_b = T(0.931) + T(2.53) * m_smu;
+                m_a = T(-0.059) + T(0.02483) * m_b;
+                m_log_inv_alpha = stk::log(T(1.1239) + T(1.1328) / (m_b - T(3.4)));
+                m_vr = T(0.9277) - T(3.6224) / (m_b - T(2));
+                m_log_mean = stk::log(m_mean);
+            }
+
+            BOOST_STATIC_CONSTEXPR std::uint64_t max_table_size = 64;
+
             T m_mean;
 
+            //! Inversion state.
+            std::vector<T> m_cdf;
+            T              m_tail_pmf{};
+
+            //! PTRS state.
+            T m_smu{};
+            T m_a{};
+            T m_b{};
+            T m_log_inv_alpha{};
+            T m_vr{};
+            T m_log_mean{};
+
 		};
 
     	explicit zero_truncated_poisson_distribution(T mean = 1)
@@ -58,19 +158,19 @@ namespace stk {
         }
 
 	    T mean() const { return m_parameters.mean(); }
-	   
+
 	    param_type param() const { return m_parameters; }
 
 	    void param(const param_type& params) { m_parameters = params; }
 
-	    result_type (min)() const {	return std::numeric_limits<result_type>::denorm_min(); }
+	    result_type (min)() const {	return 1; }
 
     	result_type (max)() const { return (std::numeric_limits<result_type>::max)(); }
 
 	    void reset() { }
 
     	template<typename Engine>
-		result_type operator()(Engine& e) 
+		result_type operator()(Engine& e)
         {
 			return this->operator()(e, m_parameters);
 		}
@@ -78,21 +178,38 @@ namespace stk {
 	    template<typename Engine>
 		result_type operator()(Engine& e, const param_type& params)
 		{
-			using std::exp;//! TODO platform dependence here.
-			using std::log;//! TODO platform dependence here.
-			auto rp = exp(-params.mean());
-            boost::random::uniform_real_distribution<T> U(rp, 1.0);
-            auto u = U(e);
-			auto t = -log(u);
-			boost::random::poisson_distribution<ResultType, T> dist(params.mean()-t);
-			return 1 + dist(e);
+            if (params.use_inversion())
+                return invert(e, params);
+            return ptrs(e, params);
 		}
 
+        //! Fill the output with variates amortizing the parameter dispatch across the batch.
+        template<typename Engine>
+        void generate(Engine& e, stk::span<result_type> out)
+        {
+            generate(e, out, m_parameters);
+        }
+
+        template<typename Engine>
+        void generate(Engine& e, stk::span<result_type> out, const param_type& params)
+        {
+            if (params.use_inversion())
+            {
+                for (auto& r : out)
+                    r = invert(e, params);
+            }
+            else
+            {
+                for (auto& r : out)
+                    r = ptrs(e, params);
+            }
+        }
+
 	    template<typename CharT, typename Traits>
 		std::basic_istream<CharT, Traits>& read(std::basic_istream<CharT, Traits>& str)
 		{
             T mean;
-            str >> mean; 
+            str >> mean;
             m_parameters = param_type(mean);
             return str;
 		}
@@ -100,39 +217,89 @@ namespace stk {
 	    template<typename CharT, typename Traits>
 		std::basic_ostream<CharT, Traits>& write(std::basic_ostream<CharT, Traits>& str) const
 		{
-            str << m_parameters.m_mean;
+            str << m_parameters.mean();
 		    return str;
 		}
 
     private:
 
+        template<typename Engine>
+        static result_type invert(Engine& e, const param_type& params)
+        {
+            boost::random::uniform_real_distribution<T> U;
+            auto u = U(e);
+            const auto& cdf = params.m_cdf;
+            for (std::size_t i = 0; i < cdf.size(); ++i)
+                if (u <= cdf[i])
+                    return static_cast<result_type>(i + 1);
+
+            //! Continue the recurrence beyond the table.
+            auto k = static_cast<std::uint64_t>(cdf.size());
+            auto F = cdf.back();
+            auto p = params.m_tail_pmf;
+            while (u > F && p > T{})
+            {
+                p *= params.m_mean / static_cast<T>(++k);
+                F += p;
+            }
+
+            return static_cast<result_type>(k);
+        }
+
+        template<typename Engine>
+        static result_type ptrs(Engine& e, const param_type& params)
+        {
+            using std::abs;
+            using std::floor;
+
+            boost::random::uniform_real_distribution<T> U;
+            while (true)
+            {
+                auto u = U(e) - T(0.5);
+                auto v = U(e);
+                auto us = T(0.5) - abs(u);
+                auto k = floor((T(2) * params.m_a / us + params.m_b) * u + params.m_mean + T(0.43));
+                if (k < T(1))
+                    continue;
+
+                if (us >= T(0.07) && v <= params.m_vr)
+                    return static_cast<result_type>(k);
+
+                if (us < T(0.013) && v > us)
+                    continue;
+
+                auto ik = static_cast<std::uint64_t>(k);
+                if (stk::log(v) + params.m_log_inv_alpha - stk::log(params.m_a / (us * us) + params.m_b) <= -params.m_mean + k * params.m_log_mean - detail::log_factorial<T>(ik))
+                    return static_cast<result_type>(k);
+            }
+        }
+
 	    param_type m_parameters;
 
 	};
 
-    template<typename T>
-	inline bool operator ==(const zero_truncated_poisson_distribution<T>& l, const zero_truncated_poisson_distribution<T>& r)
+    template<typename ResultType, typename T>
+	inline bool operator ==(const zero_truncated_poisson_distribution<ResultType, T>& l, const zero_truncated_poisson_distribution<ResultType, T>& r)
 	{
 	    return (l.param() == r.param());
 	}
 
-    template<typename T>
-	inline bool operator !=(const zero_truncated_poisson_distribution<T>& l, const zero_truncated_poisson_distribution<T>& r)
-	{	
+    template<typename ResultType, typename T>
+	inline bool operator !=(const zero_truncated_poisson_distribution<ResultType, T>& l, const zero_truncated_poisson_distribution<ResultType, T>& r)
+	{
 	    return !(l == r);
 	}
 
-    template<typename CharT, typename Traits, typename T>
-	inline std::basic_ostream<CharT, Traits>& operator <<(std::basic_ostream<CharT, Traits>& str, const zero_truncated_poisson_distribution<T>& dist)
+    template<typename CharT, typename Traits, typename ResultType, typename T>
+	inline std::basic_ostream<CharT, Traits>& operator <<(std::basic_ostream<CharT, Traits>& str, const zero_truncated_poisson_distribution<ResultType, T>& dist)
 	{
 	    return dist.write(str);
 	}
 
-    template<typename CharT, typename Traits, typename T>
-	inline std::basic_istream<CharT, Traits>& operator >>( std::basic_istream<CharT, Traits>& str, zero_truncated_poisson_distribution<T>& dist)
+    template<typename CharT, typename Traits, typename ResultType, typename T>
+	inline std::basic_istream<CharT, Traits>& operator >>( std::basic_istream<CharT, Traits>& str, zero_truncated_poisson_distribution<ResultType, T>& dist)
 	{
 	    return dist.read(str);
 	}
 
 }//! namespace stk;
-
@@ -14,7 +14,10 @@
 #endif
 
 #include <stk/units/probability.hpp>
+#include <stk/math/exp_batch.hpp>
+#include <stk/utility/span.hpp>
 #include <geometrix/arithmetic/math_kernel.hpp>
+#include <cstdint>
 
 namespace stk {
 
@@ -33,7 +36,51 @@ struct binary_logit_model
     {
         auto result = 1.0 / ( 1.0 + Math::exp(-m_utility(a...)));
         
-        return result.value() * units::proportion;
+        return static_cast<double>(result) * units::proportion;
+    }
+
+    //! Evaluate the utilities of n decision makers whose inputs are given as columns (structure of arrays) indexed by a[i].
+    template <typename... Columns>
+    void utilities(stk::span<double> out, const Columns&... a) const
+    {
+        for (std::size_t i = 0; i < out.size(); ++i)
+            out[i] = static_cast<double>(m_utility(a[i]...));
+    }
+
+    //! Batch evaluation of the probabilities 1 / (1 + exp(-u)) for a batch of utilities using the vectorized exp_batch kernel.
+    static void probabilities(stk::span<const double> u, stk::span<double> p)
+    {
+        GEOMETRIX_ASSERT(p.size() >= u.size());
+        for (std::size_t i = 0; i < u.size(); ++i)
+            p[i] = -u[i];
+        stk::exp_batch(stk::span<const double>(p.data(), u.size()), p);
+        for (std::size_t i = 0; i < u.size(); ++i)
+            p[i] = 1.0 / (1.0 + p[i]);
+    }
+
+    //! Sample the decisions for a batch of utilities given one uniform variate in [0, 1) per decision maker. choices[i] is 1 when the
+    //! event occurs (uniforms[i] < p_i, tested without division as uniforms[i] * (1 + exp(-u_i)) < 1.) Returns the number of events.
+    static std::size_t choose(stk::span<const double> u, stk::span<const double> uniforms, stk::span<std::uint8_t> choices)
+    {
+        GEOMETRIX_ASSERT(uniforms.size() == u.size() && choices.size() >= u.size());
+        BOOST_CONSTEXPR_OR_CONST std::size_t block_size = 256;
+        double e[block_size];
+        std::size_t count = 0;
+        for (std::size_t offset = 0; offset < u.size(); offset += block_size)
+        {
+            auto n = (std::min)(block_size, u.size() - offset);
+            for (std::size_t i = 0; i < n; ++i)
+                e[i] = -u[offset + i];
+            stk::exp_batch(stk::span<const double>(e, n), stk::span<double>(e, n));
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                auto c = static_cast<std::uint8_t>(uniforms[offset + i] * (1.0 + e[i]) < 1.0);
+                choices[offset + i] = c;
+                count += c;
+            }
+        }
+
+        return count;
     }
 
     UtilityModel m_utility;
@@ -0,0 +1,146 @@
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+/////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <stk/sim/histogram_1d.hpp>
+#include <stk/thread/cache_line_padding.hpp>
+#include <geometrix/utility/assert.hpp>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace stk {
+
+//! A histogram which may be filled concurrently from many threads without locks.
+//! Each thread fills its own shard of bins which are laid out on separate cache lines. Shards are selected by a thread index in the same way as
+//! stk::thread::scalable_task_counter: 0 is the main thread and [1..nthreads] are the pool threads (see work_stealing_thread_pool::get_thread_id().)
+//! Each shard must only be filled by one thread at a time. Bins are stored as relaxed atomics so a snapshot may be taken while fills are in flight.
+//! snapshot() sums the shards in shard order so the result is independent of the order in which the fills from each thread interleaved.
+template <typename T>
+class concurrent_histogram_1d
+{
+    static_assert(std::atomic<T>::is_always_lock_free, "concurrent_histogram_1d requires lock free atomics of T.");
+
+public:
+
+    using value_type = T;
+    BOOST_STATIC_CONSTEXPR std::size_t invalid_bin = histogram_1d<T>::invalid_bin;
+
+    concurrent_histogram_1d(std::size_t nbins, T xlo, T xhi, std::uint32_t nthreads = std::thread::hardware_concurrency())
+        : m_nbins(nbins)
+        , m_min(xlo)
+        , m_max(xhi)
+        , m_invBinWidth(nbins / (xhi - xlo))
+        , m_nshards(nthreads + 1)
+        , m_stride(padded_stride(nbins))
+        , m_bins(new std::atomic<T>[m_nshards * m_stride + cache_line_elements()])
+        , m_counts(m_nshards)
+    {
+        GEOMETRIX_ASSERT(nbins != 0);
+        GEOMETRIX_ASSERT(xhi > xlo);
+        reset();
+    }
+
+    std::size_t get_number_bins() const { return m_nbins; }
+    std::size_t get_number_shards() const { return m_nshards; }
+    T           get_min() const { return m_min; }
+    T           get_max() const { return m_max; }
+
+    std::size_t find_bin(T x) const
+    {
+        if (x >= m_min && x < m_max)
+        {
+            auto bin = static_cast<std::size_t>((x - m_min) * m_invBinWidth);
+            return bin < m_nbins ? bin : m_nbins - 1;
+        }
+
+        if (x == m_max)
+            return m_nbins - 1;
+
+        return invalid_bin;
+    }
+
+    //! Fill the shard owned by thread tidx. Returns the bin or invalid_bin if x is outside the domain (in which case nothing is recorded.)
+    std::size_t fill(std::uint32_t tidx, T x, T w = T(1))
+    {
+        GEOMETRIX_ASSERT(tidx < m_nshards);
+        auto bin = find_bin(x);
+        if (bin == invalid_bin)
+            return bin;
+
+        add(*m_counts[tidx], T(1));
+        add(shard(tidx)[bin], w);
+        return bin;
+    }
+
+    //! Merge the shards into a histogram_1d. This is O(bins * shards.)
+    histogram_1d<T> snapshot() const
+    {
+        histogram_1d<T> h(m_nbins, m_min, m_max);
+        for (std::size_t s = 0; s < m_nshards; ++s)
+        {
+            const auto* bins = shard(s);
+            for (std::size_t i = 0; i < m_nbins; ++i)
+                h.m_bins[i] += bins[i].load(std::memory_order_relaxed);
+            h.m_counts += m_counts[s]->load(std::memory_order_relaxed);
+        }
+
+        return h;
+    }
+
+    //! Clear all shards. Not safe to call concurrently with fill.
+    void reset()
+    {
+        for (std::size_t i = 0; i < m_nshards * m_stride + cache_line_elements(); ++i)
+            m_bins[i].store(T{}, std::memory_order_relaxed);
+        for (auto& c : m_counts)
+            c->store(T{}, std::memory_order_relaxed);
+    }
+
+private:
+
+    static BOOST_CONSTEXPR std::size_t cache_line_elements()
+    {
+        return (STK_CACHE_LINE_SIZE + sizeof(std::atomic<T>) - 1) / sizeof(std::atomic<T>);
+    }
+
+    //! Round the shard size up to a whole number of cache lines so no two shards share a line.
+    static std::size_t padded_stride(std::size_t nbins)
+    {
+        auto n = cache_line_elements();
+        return ((nbins + n - 1) / n) * n;
+    }
+
+    //! The bins array is over-allocated by a cache line so the first shard may be aligned.
+    std::atomic<T>* shard(std::size_t s) const
+    {
+        auto p = reinterpret_cast<std::uintptr_t>(m_bins.get());
+        auto aligned = (p + STK_CACHE_LINE_SIZE - 1) & ~static_cast<std::uintptr_t>(STK_CACHE_LINE_SIZE - 1);
+        return reinterpret_cast<std::atomic<T>*>(aligned) + s * m_stride;
+    }
+
+    //! Single writer per shard so a relaxed load/store suffices (no read-modify-write.)
+    static void add(std::atomic<T>& a, T w)
+    {
+        a.store(a.load(std::memory_order_relaxed) + w, std::memory_order_relaxed);
+    }
+
+    std::size_t                                     m_nbins;
+    T                                               m_min;
+    T                                               m_max;
+    T                                               m_invBinWidth;
+    std::size_t                                     m_nshards;
+    std::size_t                                     m_stride;
+    std::unique_ptr<std::atomic<T>[]>               m_bins;
+    std::vector<thread::padded<std::atomic<T>>>     m_counts;
+
+};
+
+}//namespace stk;
@@ -0,0 +1,410 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef STK_SIM_EVENT_SCHEDULER_HPP
+#define STK_SIM_EVENT_SCHEDULER_HPP
+
+#if defined(_MSC_VER)
+    #pragma once
+#endif
+
+#include <stk/container/calendar_queue.hpp>
+#include <stk/container/event_dispatch.hpp>
+#include <geometrix/utility/assert.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace stk {
+
+    //! Identifies a scheduled event so it may be cancelled. Handles are invalidated when the event runs or is cancelled (slots are reused
+    //! with a new generation so a stale handle never refers to a later event.)
+    struct event_handle
+    {
+        BOOST_STATIC_CONSTEXPR std::uint32_t invalid_index = (std::numeric_limits<std::uint32_t>::max)();
+
+        std::uint32_t index{ invalid_index };
+        std::uint32_t generation{ 0 };
+
+        bool is_valid() const { return index != invalid_index; }
+    };
+
+    //! A discrete event simulation kernel. Events are callbacks scheduled at a time and executed in time order (events at the same time run
+    //! in the order they were scheduled.) Pending events are kept in a calendar_queue.
+    //!
+    //! Each event may carry an entity key. run_until(pool, t) dispatches the events of each timestamp in parallel on a thread pool
+    //! (e.g. work_stealing_thread_pool) under a conservative rule: events with the same key run sequentially in schedule order on one task and
+    //! events with different keys run concurrently. Events scheduled with no_key conflict with everything and run alone. Handlers
+    //! running in parallel may schedule and cancel events; the new events are sequenced after the timestamp completes in the order of the
+    //! events that created them so a parallel run executes the same event sequence as a serial run. An event of the current timestamp
+    //! which has not yet started may be cancelled; that is deterministic (as in a serial run) when the canceller shares its key or either is
+    //! unkeyed, while an event of another key may already be running concurrently (and then cancel returns false.)
+    template <typename Time = double, typename Key = std::uint64_t, typename FunctionStorage = use_std_function>
+    class event_scheduler
+    {
+    public:
+
+        using time_type = Time;
+        using key_type = Key;
+        using function_storage = typename detail::function_chooser<FunctionStorage>::template apply<void()>::type;
+
+        BOOST_STATIC_CONSTEXPR Key no_key = (std::numeric_limits<Key>::max)();
+
+        explicit event_scheduler(Time start = Time(0), Time bucketWidth = Time(1))
+            : m_now(start)
+            , m_queue(bucketWidth)
+        {}
+
+        Time        now() const { return m_now; }
+        bool        empty() const { return m_queue.size() == m_cancelled; }
+        std::size_t get_number_pending() const { return m_queue.size() - m_cancelled; }
+        std::size_t get_number_executed() const { return m_executed; }
+
+        //! Schedule fn to run at time t (t must not be earlier than now().)
+        template <typename Fn>
+        event_handle schedule(Time t, Fn&& fn, Key key = no_key)
+        {
+            GEOMETRIX_ASSERT(t >= m_now);
+            if (auto* c = get_staging())
+            {
+                std::unique_lock<std::mutex> lk{ m_mutex };
+                auto h = allocate(t, std::forward<Fn>(fn), key);
+                c->buffer->emplace_back(c->parent, h.index);
+                return h;
+            }
+
+            auto h = allocate(t, std::forward<Fn>(fn), key);
+            m_queue.push(t, h.index);
+            return h;
+        }
+
+        //! Schedule fn to run dt after now().
+        template <typename Fn>
+        event_handle schedule_in(Time dt, Fn&& fn, Key key = no_key)
+        {
+            return schedule(m_now + dt, std::forward<Fn>(fn), key);
+        }
+
+        //! Cancel a pending event. Returns false if the event has already run (or is running) or was cancelled.
+        bool cancel(const event_handle& h)
+        {
+            if (get_staging())
+            {
+                std::unique_lock<std::mutex> lk{ m_mutex };
+                return cancel_impl(h);
+            }
+
+            return cancel_impl(h);
+        }
+
+        bool is_pending(const event_handle& h) const
+        {
+            if (get_staging())
+            {
+                std::unique_lock<std::mutex> lk{ m_mutex };
+                return is_pending_impl(h);
+            }
+
+            return is_pending_impl(h);
+        }
+
+        //! Execute all events up to and including time t serially and advance now() to t. Returns the number of events executed.
+        std::size_t run_until(Time t)
+        {
+            auto count = process(t);
+            m_now = (std::max)(m_now, t);
+            return count;
+        }
+
+        //! Execute all events serially.
+        std::size_t run()
+        {
+            return process((std::numeric_limits<Time>::max)());
+        }
+
+        //! Execute all events up to and including time t dispatching the events of each timestamp concurrently on pool by entity key.
+        template <typename Pool>
+        std::size_t run_until(Pool& pool, Time t)
+        {
+            auto count = process(pool, t);
+            m_now = (std::max)(m_now, t);
+            return count;
+        }
+
+        template <typename Pool>
+        std::size_t run(Pool& pool)
+        {
+            return process(pool, (std::numeric_limits<Time>::max)());
+        }
+
+    private:
+
+        enum class slot_state : std::uint8_t { free, pending, running, cancelled };
+
+        struct slot
+        {
+            function_storage fn;
+            Time             time{};
+            Key              key{ no_key };
+            std::uint32_t    generation{ 0 };
+            slot_state       state{ slot_state::free };
+        };
+
+        //! (position of the scheduling event in its timestamp, slot) of the events scheduled by a group during parallel dispatch.
+        using staging_buffer = std::vector<std::pair<std::uint32_t, std::uint32_t>>;
+
+        //! The scheduler dispatching the handler running on this thread, where the events it schedules are staged and the position of its
+        //! event.
+        struct staging_context
+        {
+            const event_scheduler* owner{ nullptr };
+            staging_buffer*        buffer{ nullptr };
+            std::uint32_t          parent{ 0 };
+        };
+
+        std::size_t process(Time t)
+        {
+            std::size_t count = 0;
+            while (!m_queue.empty() && m_queue.top().time <= t)
+            {
+                auto e = m_queue.pop();
+                if (m_slots[e.value].state == slot_state::cancelled)
+                {
+                    release(e.value);
+                    --m_cancelled;
+                    continue;
+                }
+
+                //! The handler may schedule events (growing the slots) so it runs from a local.
+                m_now = e.time;
+                auto fn = std::move(m_slots[e.value].fn);
+                release(e.value);
+                fn();
+                ++count;
+            }
+
+            m_executed += count;
+            return count;
+        }
+
+        template <typename Pool>
+        std::size_t process(Pool& pool, Time t)
+        {
+            std::size_t count = 0;
+            std::vector<std::uint32_t> events;
+            while (!m_queue.empty() && m_queue.top().time <= t)
+            {
+                //! Gather the live events of the next timestamp in sequence order.
+                auto now = m_queue.top().time;
+                events.clear();
+                while (!m_queue.empty() && m_queue.top().time == now)
+                {
+                    auto idx = m_queue.pop().value;
+                    if (m_slots[idx].state == slot_state::cancelled)
+                    {
+                        release(idx);
+                        --m_cancelled;
+                    }
+                    else
+                        events.push_back(idx);
+                }
+
+                m_now = now;
+                count += dispatch(pool, events);
+
+                //! The slots stay pending until their handlers run so the handlers before them may still cancel them.
+                for (auto idx : events)
+                {
+                    if (m_slots[idx].state == slot_state::cancelled)
+                        --m_cancelled;
+                    release(idx);
+                }
+            }
+
+            m_executed += count;
+            return count;
+        }
+
+        bool is_pending_impl(const event_handle& h) const
+        {
+            return h.is_valid() && h.index < m_slots.size() && m_slots[h.index].generation == h.generation && m_slots[h.index].state == slot_state::pending;
+        }
+
+        static staging_context& get_staging_context()
+        {
+            static thread_local staging_context c;
+            return c;
+        }
+
+        //! The staging of the handler running on this thread when it is dispatched in parallel by this scheduler (else null.)
+        staging_context* get_staging() const
+        {
+            auto& c = get_staging_context();
+            return c.owner == this ? &c : nullptr;
+        }
+
+        template <typename Fn>
+        event_handle allocate(Time t, Fn&& fn, Key key)
+        {
+            std::uint32_t idx;
+            if (!m_free.empty())
+            {
+                idx = m_free.back();
+                m_free.pop_back();
+            }
+            else
+            {
+                GEOMETRIX_ASSERT(m_slots.size() < event_handle::invalid_index);
+                idx = static_cast<std::uint32_t>(m_slots.size());
+                m_slots.emplace_back();
+            }
+
+            auto& s = m_slots[idx];
+            s.fn = std::forward<Fn>(fn);
+            s.time = t;
+            s.key = key;
+            s.state = slot_state::pending;
+            return { idx, s.generation };
+        }
+
+        void release(std::uint32_t idx)
+        {
+            auto& s = m_slots[idx];
+            s.fn = function_storage();
+            s.state = slot_state::free;
+            ++s.generation;
+            m_free.push_back(idx);
+        }
+
+        bool cancel_impl(const event_handle& h)
+        {
+            if (!is_pending_impl(h))
+                return false;
+
+            //! The entry stays in the queue and is discarded when it reaches the front.
+            auto& s = m_slots[h.index];
+            s.state = slot_state::cancelled;
+            s.fn = function_storage();
+            ++m_cancelled;
+            return true;
+        }
+
+        //! Run the gathered event idx unless a handler before it cancelled it. Returns 1 if it ran.
+        std::size_t execute(std::uint32_t idx)
+        {
+            function_storage fn;
+            {
+                std::unique_lock<std::mutex> lk{ m_mutex };
+                auto& s = m_slots[idx];
+                if (s.state == slot_state::cancelled)
+                    return 0;
+                s.state = slot_state::running;
+                fn = std::move(s.fn);
+            }
+
+            fn();
+            return 1;
+        }
+
+        //! Run the events of one timestamp. Runs of keyed events are grouped by key and the groups run concurrently; unkeyed events run alone.
+        //! Returns the number of events run.
+        template <typename Pool>
+        std::size_t dispatch(Pool& pool, const std::vector<std::uint32_t>& events)
+        {
+            std::vector<Key> keys(events.size());
+            for (std::size_t i = 0; i < events.size(); ++i)
+                keys[i] = m_slots[events[i]].key;
+
+            std::size_t count = 0;
+            std::vector<std::uint32_t> order;
+            std::vector<std::size_t> groups;
+            std::vector<std::size_t> counts;
+            std::vector<staging_buffer> staged;
+            staging_buffer sequenced;
+            for (std::size_t first = 0; first < events.size();)
+            {
+                if (keys[first] == no_key)
+                {
+                    count += execute(events[first++]);
+                    continue;
+                }
+
+                auto last = first;
+                while (last < events.size() && keys[last] != no_key)
+                    ++last;
+
+                //! Stable sort by key keeps the schedule order within each key.
+                order.resize(last - first);
+                std::iota(order.begin(), order.end(), static_cast<std::uint32_t>(first));
+                std::stable_sort(order.begin(), order.end(), [&keys](std::uint32_t a, std::uint32_t b) { return keys[a] < keys[b]; });
+                groups.clear();
+                for (std::size_t i = 0; i < order.size(); ++i)
+                    if (i == 0 || keys[order[i]] != keys[order[i - 1]])
+                        groups.push_back(i);
+                groups.push_back(order.size());
+
+                auto ngroups = groups.size() - 1;
+                if (ngroups == 1)
+                {
+                    for (auto i : order)
+                        count += execute(events[i]);
+                }
+                else
+                {
+                    staged.assign(ngroups, staging_buffer());
+                    counts.assign(ngroups, 0);
+                    pool.parallel_apply(static_cast<std::ptrdiff_t>(ngroups), [this, &events, &order, &groups, &staged, &counts](std::ptrdiff_t g)
+                    {
+                        //! Restored after so a handler running a nested parallel dispatch on this thread keeps its own context.
+                        auto& c = get_staging_context();
+                        auto saved = c;
+                        c.owner = this;
+                        c.buffer = &staged[g];
+                        for (auto i = groups[g]; i < groups[g + 1]; ++i)
+                        {
+                            c.parent = order[i];
+                            counts[g] += execute(events[order[i]]);
+                        }
+                        c = saved;
+                    });
+
+                    //! Sequence the events scheduled by the handlers in the order of the events which scheduled them as a serial run does.
+                    sequenced.clear();
+                    for (std::size_t g = 0; g < ngroups; ++g)
+                    {
+                        count += counts[g];
+                        sequenced.insert(sequenced.end(), staged[g].begin(), staged[g].end());
+                    }
+                    std::stable_sort(sequenced.begin(), sequenced.end(), [](const std::pair<std::uint32_t, std::uint32_t>& a, const std::pair<std::uint32_t, std::uint32_t>& b) { return a.first < b.first; });
+                    for (auto& e : sequenced)
+                        m_queue.push(m_slots[e.second].time, e.second);
+                }
+
+                first = last;
+            }
+
+            return count;
+        }
+
+        Time                                m_now;
+        calendar_queue<std::uint32_t, Time> m_queue;
+        std::vector<slot>                   m_slots;
+        std::vector<std::uint32_t>          m_free;
+        std::size_t                         m_cancelled{ 0 };
+        std::size_t                         m_executed{ 0 };
+        mutable std::mutex                  m_mutex;
+
+    };
+
+}//! namespace stk;
+
+#endif//! STK_SIM_EVENT_SCHEDULER_HPP
@@ -14,82 +14,36 @@
 #include <boost/math/distributions/normal.hpp>
 #include <boost/math/distributions/chi_squared.hpp>
 #include <boost/random/uniform_real_distribution.hpp>
+#include <stk/sim/histogram_axis.hpp>
 #include <stk/geometry/tolerance_policy.hpp>
+#include <stk/random/alias_table.hpp>
+#include <stk/utility/span.hpp>
 #include <algorithm>
+#include <numeric>
 #include <random>
 #include <ostream>
 
 namespace stk {
 
 template <typename T>
-class histogram_1d
-{
-    class axis
-    {
-    public:
-
-        axis() = default;
-
-        axis(std::size_t nbins, T xmin, T xmax)
-            : m_numBins(nbins)
-            , m_min(xmin)
-            , m_max(xmax)
-            , m_binWidth((xmax - xmin) / nbins)
-        {}
-
-        std::size_t get_number_bins() const { return m_numBins; }
-
-        std::size_t find_bin(T x) const
-        {
-            if (x >= m_min && x < m_max)
-                return boost::numeric_cast<std::size_t>(m_numBins*(x - m_min) / (m_max - m_min));
-
-            if (x == m_max)
-                return m_numBins - 1;
-
-            return invalid_bin;
-        }
-
-        T get_bin_width(std::size_t /*bin*/) const
-        {
-            return m_binWidth;
-        }
+class concurrent_histogram_1d;
 
-        T get_bin_low_edge(std::size_t bin) const
-        {
-            return m_min + bin * m_binWidth;
-        }
-
-        T get_bin_center(std::size_t bin) const
-        {
-           return get_bin_low_edge(bin) + 0.5 * m_binWidth;
-        }
-
-        T get_bin_hi_edge(std::size_t bin) const
-        {
-           return m_min + (bin+1) * m_binWidth;
-        }
-
-        T           get_min() const {return m_min;}
-        T           get_max() const {return m_max;}
+template <typename T, std::size_t Dimension>
+class histogram_nd;
 
-        template <typename NumberComparisonPolicy>
-        bool equals(axis const& rhs, const NumberComparisonPolicy& cmp) const
-        {
-            return m_numBins == rhs.m_numBins && cmp.equals(m_min, rhs.m_min) && cmp.equals(m_max, rhs.m_max);
-        }
+template <typename T>
+class histogram_1d
+{
+    friend class concurrent_histogram_1d<T>;
+    template <typename U, std::size_t D>
+    friend class histogram_nd;
 
-    private:
+    using axis = histogram_axis<T>;
 
-        std::size_t    m_numBins = 1;
-        T              m_min = 0;
-        T              m_max = 1;
-        T              m_binWidth = 1;
-    };
 public:
 
     using value_type = T;
-    static const std::size_t invalid_bin = static_cast<std::size_t>(-1);
+    static const std::size_t invalid_bin = axis::invalid_bin;
 
     histogram_1d(std::size_t nbins, T xlo, T xhi)
         : m_axis(nbins, xlo, xhi)
@@ -127,6 +81,75 @@ public:
         return bin;
     }
 
+    //! Fill a batch of values with optional weights (unit weights if ws is empty.) Values outside [min, max] are skipped.
+    //! Bins are computed for a block of values in a branch free loop before being accumulated. Returns the number of values filled.
+    std::size_t fill_batch(stk::span<const T> xs, stk::span<const T> ws = {})
+    {
+        GEOMETRIX_ASSERT(ws.empty() || ws.size() == xs.size());
+        invalidate_cdf();
+
+        BOOST_CONSTEXPR_OR_CONST std::size_t block_size = 256;
+        std::uint32_t bins[block_size];
+        const auto nbins = get_number_bins();
+        const auto xmin = m_axis.get_min();
+        const auto xmax = m_axis.get_max();
+        const auto inv = m_axis.get_inv_bin_width();
+        const auto last = static_cast<T>(nbins - 1);
+        BOOST_CONSTEXPR_OR_CONST std::size_t number_lanes = 4;
+
+        //! The lanes cost O(nbins) to clear and reduce so a batch smaller than the histogram accumulates directly into the bins.
+        const bool useLanes = xs.size() >= nbins;
+        std::vector<T> lanes(useLanes ? number_lanes * (nbins + 1) : 0, T{});
+        std::size_t filled = 0;
+        for (std::size_t offset = 0; offset < xs.size(); offset += block_size)
+        {
+            auto n = (std::min)(block_size, xs.size() - offset);
+            const auto* px = xs.data() + offset;
+
+            //! Out of range values map to nbins which is the sentinel for 'skip'.
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                auto x = px[i];
+                auto t = (std::min)((x - xmin) * inv, last);
+                auto inRange = (x >= xmin) & (x <= xmax);
+                bins[i] = inRange ? static_cast<std::uint32_t>(t) : static_cast<std::uint32_t>(nbins);
+            }
+
+            //! Consecutive values often land in the same bin which serializes the read-modify-write on it. Interleave the
+            //! updates over number_lanes copies of the bins (each with a trailing slot for the sentinel) and reduce at the end.
+            const auto* pw = ws.empty() ? nullptr : ws.data() + offset;
+            if (!useLanes)
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    if (bins[i] < nbins)
+                    {
+                        m_bins[bins[i]] += pw ? pw[i] : T(1);
+                        ++filled;
+                    }
+                }
+                continue;
+            }
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                auto lane = (i % number_lanes) * (nbins + 1);
+                lanes[lane + bins[i]] += pw ? pw[i] : T(1);
+                filled += bins[i] < nbins;
+            }
+        }
+
+        for (std::size_t l = 0; useLanes && l < number_lanes; ++l)
+        {
+            const auto* pl = lanes.data() + l * (nbins + 1);
+            for (std::size_t i = 0; i < nbins; ++i)
+                m_bins[i] += pl[i];
+        }
+
+        m_counts += static_cast<T>(filled);
+        return filled;
+    }
+
     std::size_t find_bin(T x) const
     {
         return m_axis.find_bin(x);
@@ -177,6 +200,8 @@ public:
         return m_axis.get_bin_width(bin);
     }
 
+    //! Draw a value distributed as the histogram (uniform within each bin.) The bin is chosen in O(1) from an alias table which is built on the first
+    //! call after the histogram was modified. Call freeze() before sampling concurrently from several threads.
     template <typename Engine>
     T           sample(Engine& eng) const
     {
@@ -186,21 +211,15 @@ public:
             return T{};
         }
 
-        boost::random::uniform_real_distribution<> U;
-        auto r = U(eng);
-        auto it = std::lower_bound(m_cdf.begin(), m_cdf.end(), r);
-        std::size_t ibin = std::distance(m_cdf.begin(), it);
-        if (it == m_cdf.end() || *it != r)
-            --ibin;
-
-        if (ibin >= get_number_bins())
-            ibin = get_number_bins() - 1;
-
-        auto x = get_bin_low_edge(ibin + 1);
-        if (r > m_cdf[ibin])
-            x += get_bin_width(ibin + 1)*(r - m_cdf[ibin]) / (m_cdf[ibin + 1] - m_cdf[ibin]);
+        boost::random::uniform_real_distribution<T> U;
+        auto ibin = m_sampler(U(eng));
+        return get_bin_low_edge(ibin) + get_bin_width(ibin) * U(eng);
+    }
 
-        return x;
+    //! Build the sampling table eagerly. Returns false if the histogram is empty.
+    bool        freeze() const
+    {
+        return create_cdf();
     }
 
     T           integral() const { return integral(0, get_number_bins()-1); }
@@ -243,7 +262,7 @@ public:
         for (auto i = 0UL; i < nbins; ++i)
         {
             sum0 += get_bin_weight(i);
-            sum1 += get_bin_weight(i);
+            sum1 += o.get_bin_weight(i);
         }
 
         //! Histograms should not be empty.
@@ -284,27 +303,20 @@ public:
 
 private:
 
-    void invalidate_cdf() { m_cdf.clear(); }
+    void invalidate_cdf() const { m_samplerValid = false; }
 
-    void cdf_valid() { return !m_cdf.empty(); }
+    bool cdf_valid() const { return m_samplerValid; }
 
     bool create_cdf() const
     {
-        std::size_t nbins = get_number_bins();
-        m_cdf.resize(nbins + 1, T{});
-        for (auto i = 1UL; i <= nbins; ++i)
-            m_cdf[i] = m_cdf[i - 1] + get_bin_weight(i-1);
+        if (cdf_valid())
+            return true;
 
-        if (m_cdf[nbins] == 0)
-        {
-            invalidate_cdf();
+        if (std::accumulate(m_bins.begin(), m_bins.end(), T{}) == T{})
             return false;
-        }
-
-        auto inv = 1.0 / m_cdf[nbins];
-        for (auto i = 1UL; i <= nbins; ++i)
-            m_cdf[i] *= inv;
 
+        m_sampler = alias_table<T>(m_bins);
+        m_samplerValid = true;
         return true;
     }
 
@@ -312,8 +324,9 @@ private:
     T              m_counts = 0;
     std::vector<T> m_bins;
 
-    //! Cache the discrete cdf array for sampling.
-    mutable std::vector<T> m_cdf;
+    //! Cache the alias table of the bin weights for sampling.
+    mutable alias_table<T> m_sampler;
+    mutable bool           m_samplerValid = false;
 };
 
 }//namespace stk;
@@ -0,0 +1,92 @@
+//! Copyright © 2018
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+/////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+
+namespace stk {
+
+//! A fixed width binning of [min, max]. Values equal to max fall in the last bin.
+template <typename T>
+class histogram_axis
+{
+public:
+
+    static constexpr std::size_t invalid_bin = static_cast<std::size_t>(-1);
+
+    histogram_axis() = default;
+
+    histogram_axis(std::size_t nbins, T xmin, T xmax)
+        : m_numBins(nbins)
+        , m_min(xmin)
+        , m_max(xmax)
+        , m_binWidth((xmax - xmin) / nbins)
+        , m_invBinWidth(nbins / (xmax - xmin))
+    {}
+
+    std::size_t get_number_bins() const { return m_numBins; }
+
+    std::size_t find_bin(T x) const
+    {
+        if (x >= m_min && x < m_max)
+            return find_bin_unchecked(x);
+
+        if (x == m_max)
+            return m_numBins - 1;
+
+        return invalid_bin;
+    }
+
+    //! x must lie in [min, max). The clamp guards the rounding of the product near max.
+    std::size_t find_bin_unchecked(T x) const
+    {
+        auto bin = static_cast<std::size_t>((x - m_min) * m_invBinWidth);
+        return bin < m_numBins ? bin : m_numBins - 1;
+    }
+
+    T get_bin_width(std::size_t /*bin*/) const
+    {
+        return m_binWidth;
+    }
+
+    T get_bin_low_edge(std::size_t bin) const
+    {
+        return m_min + bin * m_binWidth;
+    }
+
+    T get_bin_center(std::size_t bin) const
+    {
+       return get_bin_low_edge(bin) + 0.5 * m_binWidth;
+    }
+
+    T get_bin_hi_edge(std::size_t bin) const
+    {
+       return m_min + (bin+1) * m_binWidth;
+    }
+
+    T           get_inv_bin_width() const { return m_invBinWidth; }
+    T           get_min() const {return m_min;}
+    T           get_max() const {return m_max;}
+
+    template <typename NumberComparisonPolicy>
+    bool equals(histogram_axis const& rhs, const NumberComparisonPolicy& cmp) const
+    {
+        return m_numBins == rhs.m_numBins && cmp.equals(m_min, rhs.m_min) && cmp.equals(m_max, rhs.m_max);
+    }
+
+private:
+
+    std::size_t    m_numBins = 1;
+    T              m_min = 0;
+    T              m_max = 1;
+    T              m_binWidth = 1;
+    T              m_invBinWidth = 1;
+};
+
+}//namespace stk;
@@ -0,0 +1,240 @@
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+/////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <stk/sim/histogram_axis.hpp>
+#include <stk/sim/histogram_1d.hpp>
+#include <stk/geometry/tolerance_policy.hpp>
+#include <geometrix/utility/assert.hpp>
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+namespace stk {
+
+enum class histogram_storage
+{
+    automatic //! dense when the number of cells is at most histogram_nd::dense_cell_limit(), otherwise sparse.
+  , dense     //! a flat array of every cell.
+  , sparse    //! a hash map holding only the cells which have been filled.
+};
+
+//! A histogram over Dimension fixed width axes with the same binning semantics as histogram_1d (values equal to max fall in the last bin.)
+//! Small grids are stored densely. Large grids (e.g. fine occupancy grids over a large area) are stored sparsely so memory scales with the number of
+//! occupied cells. Values outside any axis are not recorded.
+template <typename T, std::size_t Dimension>
+class histogram_nd
+{
+    static_assert(Dimension > 0, "histogram_nd requires at least one dimension.");
+
+public:
+
+    using value_type = T;
+    using axis_type = histogram_axis<T>;
+    using point_type = std::array<T, Dimension>;
+    using index_type = std::array<std::size_t, Dimension>;
+
+    static constexpr std::size_t invalid_bin = axis_type::invalid_bin;
+
+    static std::size_t dense_cell_limit() { return std::size_t{ 1 } << 22; }
+
+    histogram_nd(const std::array<axis_type, Dimension>& axes, histogram_storage storage = histogram_storage::automatic)
+        : m_axes(axes)
+    {
+        m_numberCells = 1;
+        for (std::size_t d = 0; d < Dimension; ++d)
+        {
+            GEOMETRIX_ASSERT(axes[d].get_number_bins() != 0);
+            GEOMETRIX_ASSERT(m_numberCells <= (std::numeric_limits<std::size_t>::max)() / axes[d].get_number_bins());
+            m_strides[d] = m_numberCells;
+            m_numberCells *= axes[d].get_number_bins();
+        }
+
+        m_sparse = storage == histogram_storage::sparse || (storage == histogram_storage::automatic && m_numberCells > dense_cell_limit());
+        if (!m_sparse)
+            m_dense.assign(m_numberCells, T{});
+    }
+
+    bool             is_sparse() const { return m_sparse; }
+    std::size_t      get_number_cells() const { return m_numberCells; }
+    const axis_type& get_axis(std::size_t d) const { GEOMETRIX_ASSERT(d < Dimension); return m_axes[d]; }
+    T                get_counts() const { return m_counts; }
+
+    //! Returns the linear cell index or invalid_bin if x is outside the histogram (in which case nothing is recorded.)
+    std::size_t fill(const point_type& x, T w = T(1))
+    {
+        auto cell = find_cell(x);
+        if (cell == invalid_bin)
+            return cell;
+
+        ++m_counts;
+        add_cell_weight(cell, w);
+        return cell;
+    }
+
+    std::size_t find_cell(const point_type& x) const
+    {
+        auto cell = std::size_t{};
+        for (std::size_t d = 0; d < Dimension; ++d)
+        {
+            auto bin = m_axes[d].find_bin(x[d]);
+            if (bin == invalid_bin)
+                return invalid_bin;
+            cell += bin * m_strides[d];
+        }
+
+        return cell;
+    }
+
+    std::size_t get_cell(const index_type& idx) const
+    {
+        auto cell = std::size_t{};
+        for (std::size_t d = 0; d < Dimension; ++d)
+        {
+            GEOMETRIX_ASSERT(idx[d] < m_axes[d].get_number_bins());
+            cell += idx[d] * m_strides[d];
+        }
+
+        return cell;
+    }
+
+    index_type get_index(std::size_t cell) const
+    {
+        GEOMETRIX_ASSERT(cell < m_numberCells);
+        index_type idx;
+        for (std::size_t d = 0; d < Dimension; ++d)
+        {
+            idx[d] = cell % m_axes[d].get_number_bins();
+            cell /= m_axes[d].get_number_bins();
+        }
+
+        return idx;
+    }
+
+    T get_cell_weight(std::size_t cell) const
+    {
+        GEOMETRIX_ASSERT(cell < m_numberCells);
+        if (!m_sparse)
+            return m_dense[cell];
+
+        auto it = m_cells.find(cell);
+        return it != m_cells.end() ? it->second : T{};
+    }
+
+    T get_bin_weight(const index_type& idx) const
+    {
+        return get_cell_weight(get_cell(idx));
+    }
+
+    T add_cell_weight(std::size_t cell, T w)
+    {
+        GEOMETRIX_ASSERT(cell < m_numberCells);
+        if (!m_sparse)
+            return m_dense[cell] += w;
+        return m_cells[cell] += w;
+    }
+
+    point_type get_bin_center(const index_type& idx) const
+    {
+        point_type c;
+        for (std::size_t d = 0; d < Dimension; ++d)
+            c[d] = m_axes[d].get_bin_center(idx[d]);
+        return c;
+    }
+
+    //! The number of cells which have been assigned a weight.
+    std::size_t get_number_filled_cells() const
+    {
+        if (m_sparse)
+            return m_cells.size();
+        return static_cast<std::size_t>(std::count_if(m_dense.begin(), m_dense.end(), [](T w) { return w != T{}; }));
+    }
+
+    T integral() const
+    {
+        auto sum = T{};
+        for_each_filled_cell([&sum](std::size_t, T w) { sum += w; });
+        return sum;
+    }
+
+    //! Visit each cell with a non-zero weight as fn(cell, weight). Dense storage is visited in cell order; sparse storage in hash order.
+    template <typename Fn>
+    void for_each_filled_cell(Fn&& fn) const
+    {
+        if (m_sparse)
+        {
+            for (const auto& item : m_cells)
+                if (item.second != T{})
+                    fn(item.first, item.second);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < m_numberCells; ++i)
+                if (m_dense[i] != T{})
+                    fn(i, m_dense[i]);
+        }
+    }
+
+    void scale(T factor)
+    {
+        if (m_sparse)
+            for (auto& item : m_cells)
+                item.second *= factor;
+        else
+            for (auto& w : m_dense)
+                w *= factor;
+    }
+
+    //! Project onto axis d by summing over the other dimensions.
+    histogram_1d<T> project(std::size_t d) const
+    {
+        GEOMETRIX_ASSERT(d < Dimension);
+        const auto& a = m_axes[d];
+        histogram_1d<T> h(a.get_number_bins(), a.get_min(), a.get_max());
+        auto nbins = a.get_number_bins();
+        auto stride = m_strides[d];
+        for_each_filled_cell([&](std::size_t cell, T w) { h.m_bins[(cell / stride) % nbins] += w; });
+        h.m_counts = m_counts;
+        return h;
+    }
+
+    //! Add the weights of o which must have the same axes. Histograms filled on separate threads may be combined this way.
+    histogram_nd& operator +=(const histogram_nd& o)
+    {
+        GEOMETRIX_ASSERT(has_same_axes(o));
+        o.for_each_filled_cell([this](std::size_t cell, T w) { add_cell_weight(cell, w); });
+        m_counts += o.m_counts;
+        return *this;
+    }
+
+    bool has_same_axes(const histogram_nd& o) const
+    {
+        auto cmp = make_tolerance_policy(1e-6);
+        for (std::size_t d = 0; d < Dimension; ++d)
+            if (!m_axes[d].equals(o.m_axes[d], cmp))
+                return false;
+        return true;
+    }
+
+private:
+
+    std::array<axis_type, Dimension>     m_axes;
+    std::array<std::size_t, Dimension>   m_strides;
+    std::size_t                          m_numberCells;
+    bool                                 m_sparse;
+    T                                    m_counts = 0;
+    std::vector<T>                       m_dense;
+    std::unordered_map<std::size_t, T>   m_cells;
+
+};
+
+}//namespace stk;
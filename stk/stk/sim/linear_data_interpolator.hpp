@@ -14,48 +14,144 @@
 #endif
 
 #include "line_function.hpp"
+#include <stk/utility/span.hpp>
+#include <geometrix/utility/assert.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 namespace stk {
 
+//! Piecewise linear interpolation of the data (x, y) where x is strictly increasing. Queries outside [x.front(), x.back()] extrapolate the end segments.
+//! The slope of each segment is computed once at construction. When the x data are uniformly spaced the segment is found by direct index computation;
+//! otherwise by binary search. Streams of queries with locality can pass a segment hint and sorted batches are evaluated in a single merge pass.
 template <typename X, typename Y>
 struct linear_data_interpolator
 {
     using x_type = X;
     using y_type = Y;
     using slope_type = decltype(std::declval<Y>() / std::declval<X>());
-    
-    linear_data_interpolator(const std::vector<x_type>& x, const std::vector<y_type>& y)
-        : mXData(x)
-        , mYData(y)
+    using inverse_x_type = decltype(1.0 / std::declval<X>());
+
+    linear_data_interpolator(std::vector<x_type> x, std::vector<y_type> y)
+        : mXData(std::move(x))
+        , mYData(std::move(y))
     {
-        GEOMETRIX_ASSERT(x.size() > 1);
-        GEOMETRIX_ASSERT(x.size() == y.size());
+        GEOMETRIX_ASSERT(mXData.size() > 1);
+        GEOMETRIX_ASSERT(mXData.size() == mYData.size());
+
+        auto nsegments = mXData.size() - 1;
+        mSlopes.reserve(nsegments);
+        for (std::size_t i = 0; i < nsegments; ++i)
+        {
+            GEOMETRIX_ASSERT(mXData[i] < mXData[i + 1]);
+            mSlopes.push_back((mYData[i + 1] - mYData[i]) / (mXData[i + 1] - mXData[i]));
+        }
+
+        //! The grid is treated as uniform when every knot is within a small fraction of a spacing of its uniform position.
+        auto dx = (mXData.back() - mXData.front()) / static_cast<double>(nsegments);
+        mIsUniform = true;
+        for (std::size_t i = 1; i < nsegments && mIsUniform; ++i)
+        {
+            using std::abs;
+            mIsUniform = abs(static_cast<double>((mXData[i] - mXData.front()) / dx) - static_cast<double>(i)) < 1e-9;
+        }
+
+        mInvDx = 1.0 / dx;
     }
 
     y_type operator()(const x_type& x) const
     {
+        return evaluate(find_segment(x), x);
+    }
+
+    //! Evaluate with a segment hint (initialize to 0.) The hint is updated to the segment of x so that successive nearby queries find their
+    //! segment in O(1). Each caller (thread) should own its hint.
+    y_type operator()(const x_type& x, std::size_t& hint) const
+    {
+        hint = find_segment(x, hint);
+        return evaluate(hint, x);
+    }
+
+    //! Evaluate each xs[i] into ys[i]. The xs must be sorted in ascending order; the table is traversed once for the whole batch.
+    void evaluate_batch(stk::span<const x_type> xs, stk::span<y_type> ys) const
+    {
+        GEOMETRIX_ASSERT(xs.size() == ys.size());
+        GEOMETRIX_ASSERT(std::is_sorted(xs.begin(), xs.end()));
+        const auto n = xs.size();
+        if (mIsUniform)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                ys[i] = evaluate(find_uniform_segment(xs[i]), xs[i]);
+            return;
+        }
+
+        const auto last = mSlopes.size() - 1;
+        std::size_t segment = 0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const auto& x = xs[i];
+            while (segment < last && !(x < mXData[segment + 1]))
+                ++segment;
+            ys[i] = evaluate(segment, x);
+        }
+    }
+
+    bool                        is_uniform() const { return mIsUniform; }
+    std::size_t                 get_number_segments() const { return mSlopes.size(); }
+    const std::vector<x_type>&  get_x_data() const { return mXData; }
+    const std::vector<y_type>&  get_y_data() const { return mYData; }
+
+    //! The index of the segment used to evaluate x.
+    std::size_t find_segment(const x_type& x) const
+    {
+        if (mIsUniform)
+            return find_uniform_segment(x);
+
         auto it = std::upper_bound(mXData.begin(), mXData.end(), x);
-        std::size_t index = 
-            it > mXData.begin() ?
-                ( (it + 1) < mXData.end() ?
-                    std::distance(mXData.begin(), (it-1)) :
-                    mXData.size() - 2) :
-            0;
-
-        x_type xmin = mXData[index];
-        x_type xmax = mXData[index + 1];
-        y_type ymin = mYData[index];
-        y_type ymax = mYData[index + 1];
-        slope_type slope = (ymax - ymin) / (xmax - xmin);
-        y_type yIntercept = ymin;
-        
-        return line_function<x_type, y_type>(as_slope(slope), as_yintercept(yIntercept))(x-xmin);
+        auto index = static_cast<std::size_t>(std::distance(mXData.begin(), it));
+        return index > 0 ? (std::min)(index - 1, mSlopes.size() - 1) : 0;
+    }
+
+    std::size_t find_segment(const x_type& x, std::size_t hint) const
+    {
+        if (mIsUniform)
+            return find_uniform_segment(x);
+
+        GEOMETRIX_ASSERT(hint < mSlopes.size());
+        const auto last = mSlopes.size() - 1;
+
+        //! Check the hinted segment and its successor before falling back to binary search.
+        if (!(x < mXData[hint]) && (hint == last || x < mXData[hint + 1]))
+            return hint;
+        if (hint < last && !(x < mXData[hint + 1]) && (hint + 1 == last || x < mXData[hint + 2]))
+            return hint + 1;
+        if (hint == 0 && x < mXData[0])
+            return 0;
+        return find_segment(x);
     }
 
 private:
-    
-    const std::vector<x_type>   mXData;
-    const std::vector<y_type>   mYData;
+
+    std::size_t find_uniform_segment(const x_type& x) const
+    {
+        auto t = static_cast<double>((x - mXData.front()) * mInvDx);
+        if (!(t > 0.0))
+            return 0;
+        const auto last = mSlopes.size() - 1;
+        return t < static_cast<double>(last) ? static_cast<std::size_t>(t) : last;
+    }
+
+    y_type evaluate(std::size_t segment, const x_type& x) const
+    {
+        return mYData[segment] + mSlopes[segment] * (x - mXData[segment]);
+    }
+
+    std::vector<x_type>     mXData;
+    std::vector<y_type>     mYData;
+    std::vector<slope_type> mSlopes;
+    inverse_x_type          mInvDx;
+    bool                    mIsUniform{ false };
 
 };
 
@@ -0,0 +1,196 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef STK_MULTINOMIAL_LOGIT_MODEL_HPP
+#define STK_MULTINOMIAL_LOGIT_MODEL_HPP
+
+#if defined(_MSC_VER)
+    #pragma once
+#endif
+
+#include <stk/units/probability.hpp>
+#include <stk/math/exp_batch.hpp>
+#include <stk/utility/span.hpp>
+#include <geometrix/arithmetic/math_kernel.hpp>
+#include <geometrix/utility/assert.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace stk {
+
+//! A multinomial logit choice model over a fixed number of alternatives. The utility model is called as utility(k, args...) for alternative k.
+//! P(k) = exp(u_k) / sum_j exp(u_j) is evaluated as exp(u_k - lse(u)) with the log-sum-exp shifted by the maximum utility so large utilities
+//! neither overflow nor lose all precision.
+//! The batch interface takes utilities laid out alternative major (u[k * n + i] is the utility of alternative k for decision maker i.)
+template <typename UtilityModel, typename Math = geometrix::std_math_kernel>
+struct multinomial_logit_model
+{
+    multinomial_logit_model()
+    {}
+
+    multinomial_logit_model(const UtilityModel& utility, std::size_t nAlternatives)
+        : m_utility(utility)
+        , m_nAlternatives(nAlternatives)
+    {
+        GEOMETRIX_ASSERT(nAlternatives > 0);
+    }
+
+    std::size_t get_number_alternatives() const { return m_nAlternatives; }
+
+    //! The probability of choosing alternative k.
+    template <typename... Args>
+    units::probability operator()(std::size_t k, const Args&... a) const
+    {
+        GEOMETRIX_ASSERT(k < m_nAlternatives);
+        auto uk = static_cast<double>(m_utility(k, a...));
+        return Math::exp(uk - log_sum_exp(a...)) * units::proportion;
+    }
+
+    //! The log of the denominator: log(sum_k exp(u_k)).
+    template <typename... Args>
+    double log_sum_exp(const Args&... a) const
+    {
+        auto umax = -std::numeric_limits<double>::infinity();
+        for (std::size_t k = 0; k < m_nAlternatives; ++k)
+            umax = (std::max)(umax, static_cast<double>(m_utility(k, a...)));
+
+        auto sum = 0.0;
+        for (std::size_t k = 0; k < m_nAlternatives; ++k)
+            sum += Math::exp(static_cast<double>(m_utility(k, a...)) - umax);
+        return umax + Math::log(sum);
+    }
+
+    //! Choose an alternative by inversion of the choice probabilities given a uniform variate in [0, 1).
+    template <typename... Args>
+    std::size_t choose(double uniform, const Args&... a) const
+    {
+        auto lse = log_sum_exp(a...);
+        auto cum = 0.0;
+        for (std::size_t k = 0; k + 1 < m_nAlternatives; ++k)
+        {
+            cum += Math::exp(static_cast<double>(m_utility(k, a...)) - lse);
+            if (uniform < cum)
+                return k;
+        }
+
+        return m_nAlternatives - 1;
+    }
+
+    //! Evaluate the utilities of n decision makers whose inputs are given as columns (structure of arrays) indexed by a[i]. out must hold
+    //! number_alternatives * n values and is filled alternative major.
+    template <typename... Columns>
+    void utilities(std::size_t n, stk::span<double> out, const Columns&... a) const
+    {
+        GEOMETRIX_ASSERT(out.size() >= m_nAlternatives * n);
+        for (std::size_t k = 0; k < m_nAlternatives; ++k)
+            for (std::size_t i = 0; i < n; ++i)
+                out[k * n + i] = static_cast<double>(m_utility(k, a[i]...));
+    }
+
+    //! Batch evaluation of the choice probabilities for n decision makers (p has the same alternative major layout as u.)
+    void probabilities(stk::span<const double> u, std::size_t n, stk::span<double> p) const
+    {
+        GEOMETRIX_ASSERT(u.size() == m_nAlternatives * n && p.size() >= u.size());
+        std::vector<double> sums(n, 0.0);
+        shifted_exp(u, n, p, sums.data());
+        for (std::size_t i = 0; i < n; ++i)
+            sums[i] = 1.0 / sums[i];
+        for (std::size_t k = 0; k < m_nAlternatives; ++k)
+        {
+            auto* pk = p.data() + k * n;
+            for (std::size_t i = 0; i < n; ++i)
+                pk[i] *= sums[i];
+        }
+    }
+
+    //! Sample the choices of n = uniforms.size() decision makers directly from their utilities and one uniform variate in [0, 1) each.
+    //! The probabilities are never normalized: alternative k is chosen when cum_{k-1} <= uniform * sum < cum_k with cum the running sum of
+    //! exp(u_k - max u). The decision makers are processed in blocks with the loops running over the decision makers so they vectorize.
+    void choose(stk::span<const double> u, stk::span<const double> uniforms, stk::span<std::uint32_t> choices) const
+    {
+        auto n = uniforms.size();
+        GEOMETRIX_ASSERT(u.size() == m_nAlternatives * n && choices.size() >= n);
+        BOOST_CONSTEXPR_OR_CONST std::size_t block_size = 256;
+        std::vector<double> ublock(m_nAlternatives * block_size), eblock(m_nAlternatives * block_size);
+        double sums[block_size];
+        double cum[block_size];
+        for (std::size_t offset = 0; offset < n; offset += block_size)
+        {
+            auto m = (std::min)(block_size, n - offset);
+            for (std::size_t k = 0; k < m_nAlternatives; ++k)
+                std::copy_n(u.data() + k * n + offset, m, ublock.data() + k * m);
+            shifted_exp(stk::span<const double>(ublock.data(), m_nAlternatives * m), m, eblock, sums);
+
+            auto* ci = choices.data() + offset;
+            const auto* ui = uniforms.data() + offset;
+            for (std::size_t i = 0; i < m; ++i)
+            {
+                sums[i] *= ui[i];
+                cum[i] = 0.0;
+                ci[i] = 0;
+            }
+
+            for (std::size_t k = 0; k + 1 < m_nAlternatives; ++k)
+            {
+                const auto* ek = eblock.data() + k * m;
+                for (std::size_t i = 0; i < m; ++i)
+                {
+                    cum[i] += ek[i];
+                    ci[i] += static_cast<std::uint32_t>(cum[i] <= sums[i]);
+                }
+            }
+        }
+    }
+
+    UtilityModel m_utility;
+    std::size_t  m_nAlternatives{ 0 };
+
+private:
+
+    //! e[k * n + i] = exp(u[k * n + i] - max_k u[k * n + i]) and sums[i] = sum_k e[k * n + i].
+    void shifted_exp(stk::span<const double> u, std::size_t n, stk::span<double> e, double* sums) const
+    {
+        std::copy_n(u.data(), n, sums);
+        for (std::size_t k = 1; k < m_nAlternatives; ++k)
+        {
+            const auto* uk = u.data() + k * n;
+            for (std::size_t i = 0; i < n; ++i)
+                sums[i] = (std::max)(sums[i], uk[i]);
+        }
+
+        for (std::size_t k = 0; k < m_nAlternatives; ++k)
+        {
+            const auto* uk = u.data() + k * n;
+            auto* ek = e.data() + k * n;
+            for (std::size_t i = 0; i < n; ++i)
+                ek[i] = uk[i] - sums[i];
+        }
+
+        stk::exp_batch(stk::span<const double>(e.data(), m_nAlternatives * n), e);
+
+        std::fill_n(sums, n, 0.0);
+        for (std::size_t k = 0; k < m_nAlternatives; ++k)
+        {
+            const auto* ek = e.data() + k * n;
+            for (std::size_t i = 0; i < n; ++i)
+                sums[i] += ek[i];
+        }
+    }
+};
+
+template <typename Utility>
+inline multinomial_logit_model<Utility> make_multinomial_logit_model(const Utility& u, std::size_t nAlternatives)
+{
+    return multinomial_logit_model<Utility>(u, nAlternatives);
+}
+
+}//! namespace stk;
+
+#endif//STK_MULTINOMIAL_LOGIT_MODEL_HPP
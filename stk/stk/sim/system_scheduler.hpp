@@ -0,0 +1,215 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef STK_SIM_SYSTEM_SCHEDULER_HPP
+#define STK_SIM_SYSTEM_SCHEDULER_HPP
+
+#if defined(_MSC_VER)
+    #pragma once
+#endif
+
+#include <geometrix/utility/assert.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <typeindex>
+#include <vector>
+
+namespace stk {
+
+    //! Component access declarations for system_scheduler::add_system.
+    template <typename... Components>
+    struct reads {};
+
+    template <typename... Components>
+    struct writes {};
+
+    //! Timing of a system collected by the scheduler on each run.
+    struct system_statistics
+    {
+        std::string name;
+        std::size_t stage{ 0 };
+        std::size_t calls{ 0 };
+        double      last_seconds{ 0 };
+        double      total_seconds{ 0 };
+        double      max_seconds{ 0 };
+    };
+
+    //! Apply fn(entity, components&...) to each entity of registry.view<Components...>() concurrently on pool. The entities are
+    //! gathered first and split into chunks of chunkSize; fn must only touch the components of the entity it is passed.
+    //! Works with entt::registry (or anything with a compatible view<Components...>() and view.get<Component>(entity).)
+    template <typename... Components, typename Registry, typename Pool, typename Fn>
+    inline void parallel_each(Registry& registry, Pool& pool, Fn&& fn, std::size_t chunkSize = 1024)
+    {
+        GEOMETRIX_ASSERT(chunkSize > 0);
+        auto view = registry.template view<Components...>();
+        using entity_type = typename std::decay<decltype(*view.begin())>::type;
+        std::vector<entity_type> entities(view.begin(), view.end());
+        auto nchunks = (entities.size() + chunkSize - 1) / chunkSize;
+        if (nchunks < 2)
+        {
+            for (auto e : entities)
+                fn(e, view.template get<Components>(e)...);
+            return;
+        }
+
+        pool.parallel_apply(static_cast<std::ptrdiff_t>(nchunks), [&](std::ptrdiff_t c)
+        {
+            auto first = static_cast<std::size_t>(c) * chunkSize;
+            auto last = (std::min)(first + chunkSize, entities.size());
+            for (auto i = first; i < last; ++i)
+                fn(entities[i], view.template get<Components>(entities[i])...);
+        });
+    }
+
+    //! Runs ECS systems on a thread pool. Each system declares the component types it reads and writes. Two systems conflict when one
+    //! writes a component the other reads or writes; conflicting systems run in the order they were added and all others may run
+    //! concurrently. The systems are arranged into stages (stage of s = 1 + the latest stage of an earlier system it conflicts with) and
+    //! the systems of a stage run concurrently on the pool (e.g. work_stealing_thread_pool.) A system may itself use parallel_each to split
+    //! a large view over the pool.
+    template <typename Registry, typename Pool>
+    class system_scheduler
+    {
+    public:
+
+        using system_function = std::function<void(Registry&, Pool&)>;
+
+        //! Add a system fn(registry, pool). Returns the index of the system.
+        template <typename... R, typename... W, typename Fn>
+        std::size_t add_system(std::string name, reads<R...>, writes<W...>, Fn&& fn)
+        {
+            system s;
+            s.reads = { std::type_index(typeid(R))... };
+            s.writes = { std::type_index(typeid(W))... };
+            std::sort(s.reads.begin(), s.reads.end());
+            std::sort(s.writes.begin(), s.writes.end());
+            s.fn = std::forward<Fn>(fn);
+            system_statistics stats;
+            stats.name = std::move(name);
+            m_systems.push_back(std::move(s));
+            m_statistics.push_back(std::move(stats));
+            m_stages.clear();
+            return m_systems.size() - 1;
+        }
+
+        template <typename... W, typename Fn>
+        std::size_t add_system(std::string name, writes<W...> w, Fn&& fn)
+        {
+            return add_system(std::move(name), reads<>(), w, std::forward<Fn>(fn));
+        }
+
+        std::size_t get_number_systems() const { return m_systems.size(); }
+
+        bool conflicts(std::size_t i, std::size_t j) const
+        {
+            const auto& a = m_systems[i];
+            const auto& b = m_systems[j];
+            return intersects(a.writes, b.writes) || intersects(a.writes, b.reads) || intersects(a.reads, b.writes);
+        }
+
+        //! The systems of each stage (built on the first run after a system is added.)
+        const std::vector<std::vector<std::size_t>>& get_stages() const
+        {
+            if (m_stages.empty())
+                build_stages();
+            return m_stages;
+        }
+
+        //! Run all systems once.
+        void run(Registry& registry, Pool& pool)
+        {
+            for (const auto& stage : get_stages())
+            {
+                if (stage.size() == 1)
+                    run_system(stage[0], registry, pool);
+                else
+                {
+                    pool.parallel_apply(static_cast<std::ptrdiff_t>(stage.size()), [&, this](std::ptrdiff_t i)
+                    {
+                        run_system(stage[i], registry, pool);
+                    });
+                }
+            }
+        }
+
+        const std::vector<system_statistics>& get_statistics() const { return m_statistics; }
+
+        void reset_statistics()
+        {
+            for (auto& s : m_statistics)
+                s.calls = 0, s.last_seconds = s.total_seconds = s.max_seconds = 0;
+        }
+
+    private:
+
+        struct system
+        {
+            std::vector<std::type_index> reads;
+            std::vector<std::type_index> writes;
+            system_function              fn;
+        };
+
+        static bool intersects(const std::vector<std::type_index>& a, const std::vector<std::type_index>& b)
+        {
+            auto i = a.begin(), j = b.begin();
+            while (i != a.end() && j != b.end())
+            {
+                if (*i < *j)
+                    ++i;
+                else if (*j < *i)
+                    ++j;
+                else
+                    return true;
+            }
+
+            return false;
+        }
+
+        void build_stages() const
+        {
+            std::vector<std::size_t> stageOf(m_systems.size(), 0);
+            std::size_t nstages = 0;
+            for (std::size_t j = 0; j < m_systems.size(); ++j)
+            {
+                for (std::size_t i = 0; i < j; ++i)
+                    if (conflicts(i, j))
+                        stageOf[j] = (std::max)(stageOf[j], stageOf[i] + 1);
+                nstages = (std::max)(nstages, stageOf[j] + 1);
+            }
+
+            m_stages.assign(nstages, {});
+            for (std::size_t j = 0; j < m_systems.size(); ++j)
+            {
+                m_stages[stageOf[j]].push_back(j);
+                m_statistics[j].stage = stageOf[j];
+            }
+        }
+
+        void run_system(std::size_t i, Registry& registry, Pool& pool)
+        {
+            auto start = std::chrono::steady_clock::now();
+            m_systems[i].fn(registry, pool);
+            auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            auto& s = m_statistics[i];
+            ++s.calls;
+            s.last_seconds = seconds;
+            s.total_seconds += seconds;
+            s.max_seconds = (std::max)(s.max_seconds, seconds);
+        }
+
+        std::vector<system>                            m_systems;
+        mutable std::vector<system_statistics>         m_statistics;
+        mutable std::vector<std::vector<std::size_t>>  m_stages;
+
+    };
+
+}//! namespace stk;
+
+#endif//! STK_SIM_SYSTEM_SCHEDULER_HPP
@@ -0,0 +1,236 @@
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+/////////////////////////////////////////////////////////////////////////////
+/*
+The merging t-digest from
+T. Dunning and O. Ertl, Computing Extremely Accurate Quantiles Using t-Digests, 2019.
+*/
+#pragma once
+
+#include <geometrix/utility/assert.hpp>
+#include <geometrix/numeric/constants.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace stk {
+
+//! Streaming quantile sketch with bounded memory. Values are buffered and periodically compressed into at most O(compression) weighted centroids
+//! which are kept small near the tails (arcsine scale function) so extreme percentiles (e.g. p99 latency) remain accurate.
+//! Digests built on separate threads may be combined with merge(). Queries compress any buffered values and are therefore not safe to call concurrently.
+template <typename T = double>
+class tdigest
+{
+    struct centroid
+    {
+        T mean;
+        T weight;
+
+        bool operator <(const centroid& rhs) const { return mean < rhs.mean; }
+    };
+
+public:
+
+    using value_type = T;
+
+    explicit tdigest(T compression = 100, std::size_t bufferSize = 0)
+        : m_compression(compression)
+        , m_bufferSize(bufferSize ? bufferSize : static_cast<std::size_t>(5 * compression))
+    {
+        GEOMETRIX_ASSERT(compression > 0);
+        m_buffer.reserve(m_bufferSize);
+    }
+
+    T           get_compression() const { return m_compression; }
+    T           get_count() const { return m_mergedWeight + m_unmergedWeight; }
+    T           get_min() const { return m_min; }
+    T           get_max() const { return m_max; }
+    bool        empty() const { return get_count() == T{}; }
+
+    //! The number of centroids after compressing any buffered values.
+    std::size_t get_number_centroids() const
+    {
+        compress();
+        return m_centroids.size();
+    }
+
+    void add(T x, T w = T(1))
+    {
+        GEOMETRIX_ASSERT(w > T{});
+        m_min = (std::min)(m_min, x);
+        m_max = (std::max)(m_max, x);
+        m_buffer.push_back({ x, w });
+        m_unmergedWeight += w;
+        if (m_buffer.size() >= m_bufferSize)
+            compress();
+    }
+
+    void merge(const tdigest& o)
+    {
+        if (o.empty())
+            return;
+
+        //! Inserting a vector's own range into itself is undefined so a self merge merges a copy.
+        if (&o == this)
+        {
+            auto copy = o;
+            merge(copy);
+            return;
+        }
+
+        m_min = (std::min)(m_min, o.m_min);
+        m_max = (std::max)(m_max, o.m_max);
+        m_buffer.insert(m_buffer.end(), o.m_centroids.begin(), o.m_centroids.end());
+        m_buffer.insert(m_buffer.end(), o.m_buffer.begin(), o.m_buffer.end());
+        m_unmergedWeight += o.get_count();
+        compress();
+    }
+
+    //! The estimated value below which a fraction q of the weight lies.
+    T quantile(T q) const
+    {
+        GEOMETRIX_ASSERT(q >= T{} && q <= T(1));
+        compress();
+        if (m_centroids.empty())
+            return std::numeric_limits<T>::quiet_NaN();
+
+        const auto n = m_centroids.size();
+        if (n == 1)
+            return m_centroids[0].mean;
+
+        const auto target = q * m_mergedWeight;
+        if (target <= T{})
+            return m_min;
+        if (target >= m_mergedWeight)
+            return m_max;
+
+        //! Interpolate from min to the center of the first centroid.
+        const auto& first = m_centroids.front();
+        if (target < first.weight / 2)
+            return m_min + (first.mean - m_min) * target / (first.weight / 2);
+
+        auto cumulative = first.weight / 2;
+        for (std::size_t i = 0; i + 1 < n; ++i)
+        {
+            const auto& a = m_centroids[i];
+            const auto& b = m_centroids[i + 1];
+            auto dw = (a.weight + b.weight) / 2;
+            if (target < cumulative + dw)
+                return a.mean + (b.mean - a.mean) * (target - cumulative) / dw;
+            cumulative += dw;
+        }
+
+        //! Interpolate from the center of the last centroid to max.
+        const auto& last = m_centroids.back();
+        auto remaining = (std::min)((target - cumulative) / (last.weight / 2), T(1));
+        return last.mean + (m_max - last.mean) * remaining;
+    }
+
+    //! The estimated fraction of the weight at or below x.
+    T cdf(T x) const
+    {
+        compress();
+        if (m_centroids.empty())
+            return std::numeric_limits<T>::quiet_NaN();
+        if (x < m_min)
+            return T{};
+        if (x >= m_max)
+            return T(1);
+
+        const auto n = m_centroids.size();
+        const auto& first = m_centroids.front();
+        if (x < first.mean)
+        {
+            auto span = first.mean - m_min;
+            return span > T{} ? (first.weight / 2) * (x - m_min) / span / m_mergedWeight : T{};
+        }
+
+        auto cumulative = first.weight / 2;
+        for (std::size_t i = 0; i + 1 < n; ++i)
+        {
+            const auto& a = m_centroids[i];
+            const auto& b = m_centroids[i + 1];
+            auto dw = (a.weight + b.weight) / 2;
+            if (x < b.mean)
+                return (cumulative + dw * (x - a.mean) / (b.mean - a.mean)) / m_mergedWeight;
+            cumulative += dw;
+        }
+
+        const auto& last = m_centroids.back();
+        auto span = m_max - last.mean;
+        auto tail = span > T{} ? (last.weight / 2) * (x - last.mean) / span : T{};
+        return (std::min)((cumulative + tail) / m_mergedWeight, T(1));
+    }
+
+    //! Merge any buffered values into the centroids.
+    void compress() const
+    {
+        if (m_buffer.empty())
+            return;
+
+        m_buffer.insert(m_buffer.end(), m_centroids.begin(), m_centroids.end());
+        std::sort(m_buffer.begin(), m_buffer.end());
+        m_centroids.clear();
+
+        const auto total = m_mergedWeight + m_unmergedWeight;
+        auto current = m_buffer.front();
+        auto weightSoFar = T{};
+        auto limit = total * k_inverse(k(T{}) + T(1));
+        for (std::size_t i = 1; i < m_buffer.size(); ++i)
+        {
+            const auto& next = m_buffer[i];
+            if (weightSoFar + current.weight + next.weight <= limit)
+            {
+                //! Accumulate the weighted mean incrementally to avoid cancellation.
+                current.weight += next.weight;
+                current.mean += (next.mean - current.mean) * next.weight / current.weight;
+            }
+            else
+            {
+                weightSoFar += current.weight;
+                m_centroids.push_back(current);
+                current = next;
+                limit = total * k_inverse(k(weightSoFar / total) + T(1));
+            }
+        }
+
+        m_centroids.push_back(current);
+        m_buffer.clear();
+        m_mergedWeight = total;
+        m_unmergedWeight = T{};
+    }
+
+private:
+
+    //! The arcsine scale function k1 and its inverse.
+    T k(T q) const
+    {
+        return m_compression / (2 * geometrix::constants::pi<T>()) * std::asin(2 * q - 1);
+    }
+
+    T k_inverse(T kv) const
+    {
+        auto limit = m_compression / 4;
+        if (kv >= limit)
+            return T(1);
+        return (std::sin(kv * 2 * geometrix::constants::pi<T>() / m_compression) + 1) / 2;
+    }
+
+    T                              m_compression;
+    std::size_t                    m_bufferSize;
+    T                              m_min = (std::numeric_limits<T>::max)();
+    T                              m_max = std::numeric_limits<T>::lowest();
+    mutable std::vector<centroid>  m_centroids;
+    mutable std::vector<centroid>  m_buffer;
+    mutable T                      m_mergedWeight = T{};
+    mutable T                      m_unmergedWeight = T{};
+
+};
+
+}//namespace stk;
@@ -21,6 +21,7 @@
 #include <stk/thread/thread_local_pod.hpp>
 #include <stk/utility/scope_exit.hpp>
 #include <stk/utility/none.hpp>
+#include <stk/utility/trace.hpp>
 #include <stk/thread/bind/bind_processor.hpp>
 #include <stk/thread/cache_line_padding.hpp>
 #include <stk/compiler/warnings.hpp>
@@ -135,6 +136,7 @@ namespace stk {
                 while (true) {
                     if (hasTask) {
                         try {
+                            STK_TRACE_SCOPE("work_stealing_thread_pool::task");
                             task();
                             m_nTasksOutstanding.decrement(tid);
                         } catch (...) {
@@ -197,6 +199,7 @@ namespace stk {
                 while (true) {
                     if (hasTask) {
                         try {
+                            STK_TRACE_SCOPE("work_stealing_thread_pool::task");
                             task();
                             m_nTasksOutstanding.decrement(tid);
                         } catch (...) {
@@ -458,6 +461,7 @@ namespace stk {
                 std::uint32_t lastStolenIndex = 0;
                 while (!pred()) {
                     if (pop_task_from_pool_queue(task) || try_steal(lastStolenIndex, task)) {
+                        STK_TRACE_SCOPE("work_stealing_thread_pool::task");
                         task();
                         m_nTasksOutstanding.decrement(tid);
                     }
@@ -530,6 +534,7 @@ namespace stk {
             void do_work_impl(fun_wrapper& tsk, std::uint32_t& lastStolenIndex, std::uint32_t tid ) BOOST_NOEXCEPT
             {
 				if( pop_task_from_pool_queue( tsk ) || try_steal( lastStolenIndex, tsk ) ) {
+					STK_TRACE_SCOPE("work_stealing_thread_pool::task");
 					tsk();
 					m_nTasksOutstanding.decrement( tid );
 				}
@@ -0,0 +1,238 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef STK_UTILITY_BENCHMARK_HPP
+#define STK_UTILITY_BENCHMARK_HPP
+
+#if defined(_MSC_VER)
+    #pragma once
+#endif
+
+#include <stk/utility/perf_counters.hpp>
+#include <geometrix/utility/assert.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace stk {
+
+    struct benchmark_options
+    {
+        std::size_t warmup = 2;//! untimed repetitions run first.
+        std::size_t repetitions = 15;
+    };
+
+    //! Robust statistics of the nanoseconds per operation of the repetitions.
+    struct benchmark_statistics
+    {
+        double median{ 0 };
+        double mad{ 0 };//! median absolute deviation from the median.
+        double p10{ 0 };
+        double p90{ 0 };
+        double p99{ 0 };
+        double min{ 0 };
+        double max{ 0 };
+    };
+
+    //! The percentile p in [0, 1] of sorted samples (linearly interpolated.)
+    inline double get_percentile(const std::vector<double>& sorted, double p)
+    {
+        GEOMETRIX_ASSERT(!sorted.empty());
+        auto x = p * static_cast<double>(sorted.size() - 1);
+        auto i = static_cast<std::size_t>(x);
+        if (i + 1 >= sorted.size())
+            return sorted.back();
+        return sorted[i] + (x - static_cast<double>(i)) * (sorted[i + 1] - sorted[i]);
+    }
+
+    inline benchmark_statistics get_statistics(std::vector<double> samples)
+    {
+        benchmark_statistics s;
+        if (samples.empty())
+            return s;
+        std::sort(samples.begin(), samples.end());
+        s.median = get_percentile(samples, 0.5);
+        s.p10 = get_percentile(samples, 0.1);
+        s.p90 = get_percentile(samples, 0.9);
+        s.p99 = get_percentile(samples, 0.99);
+        s.min = samples.front();
+        s.max = samples.back();
+        for (auto& x : samples)
+            x = std::abs(x - s.median);
+        std::sort(samples.begin(), samples.end());
+        s.mad = get_percentile(samples, 0.5);
+        return s;
+    }
+
+    struct benchmark_result
+    {
+        std::string          name;
+        std::size_t          operations{ 0 };//! per repetition.
+        std::size_t          repetitions{ 1 };
+        double               seconds{ 0 };//! of all repetitions.
+        perf_counter_values  counters;//! of all repetitions.
+        std::vector<double>  samples;//! nanoseconds per operation of each repetition.
+        benchmark_statistics statistics;
+
+        double get_total_operations() const { return static_cast<double>(operations * repetitions); }
+        double nanoseconds_per_operation() const { return operations ? 1e9 * seconds / get_total_operations() : 0.0; }
+        double per_operation(perf_event e) const { return operations ? counters[e] / get_total_operations() : 0.0; }
+    };
+
+    //! name: wall time, IPC and misses per operation (the counters which are not available are omitted.)
+    inline std::ostream& operator<<(std::ostream& os, const benchmark_result& r)
+    {
+        os << r.name << ": ";
+        if (r.samples.size() > 1)
+            os << r.statistics.median << " ns/op (MAD " << r.statistics.mad << ", p10 " << r.statistics.p10 << ", p90 " << r.statistics.p90 << ")";
+        else
+            os << r.nanoseconds_per_operation() << " ns/op";
+        if (r.counters.is_available(perf_event::cycles) && r.counters.is_available(perf_event::instructions))
+            os << ", IPC " << r.counters.ipc();
+        for (auto e : { perf_event::l1d_misses, perf_event::llc_misses, perf_event::branch_misses })
+            if (r.counters.is_available(e))
+                os << ", " << r.per_operation(e) << " " << get_name(e) << "/op";
+        if (!r.counters.is_available(perf_event::cycles) && !r.counters.is_available(perf_event::instructions))
+            os << " (hardware counters not available)";
+        return os;
+    }
+
+    //! Time fn() which performs operations operations and collect the hardware counters of the calling thread around it.
+    template <typename Fn>
+    inline benchmark_result run_benchmark(std::string name, std::size_t operations, Fn&& fn)
+    {
+        benchmark_result r;
+        r.name = std::move(name);
+        r.operations = operations;
+        perf_counters counters;
+        {
+            perf_counter_scope scope(counters, r.counters);
+            auto start = std::chrono::steady_clock::now();
+            fn();
+            r.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+        return r;
+    }
+
+    //! Run fn() (one repetition of operations operations) options.warmup times untimed and then options.repetitions times collecting the time
+    //! and hardware counters of each repetition.
+    template <typename Fn>
+    inline benchmark_result run_benchmark(std::string name, std::size_t operations, Fn&& fn, const benchmark_options& options)
+    {
+        GEOMETRIX_ASSERT(options.repetitions > 0);
+        for (std::size_t i = 0; i < options.warmup; ++i)
+            fn();
+
+        benchmark_result r;
+        r.name = std::move(name);
+        r.operations = operations;
+        r.repetitions = options.repetitions;
+        perf_counters counters;
+        for (std::size_t i = 0; i < options.repetitions; ++i) {
+            perf_counter_scope scope(counters, r.counters);
+            auto start = std::chrono::steady_clock::now();
+            fn();
+            auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            r.seconds += seconds;
+            r.samples.push_back(operations ? 1e9 * seconds / static_cast<double>(operations) : 0.0);
+        }
+        r.statistics = get_statistics(r.samples);
+        return r;
+    }
+
+    //! Write the results as JSON: {"benchmarks": [{"name", "operations", "repetitions", "median_ns", "mad_ns", "p10_ns", "p90_ns", "p99_ns",
+    //! "min_ns", "max_ns" and when available "ipc" and "<counter>_per_op"}]}.
+    inline void write_json(std::ostream& os, const std::vector<benchmark_result>& results)
+    {
+        auto escaped = [](const std::string& v)
+        {
+            std::string e;
+            for (auto c : v) {
+                if (c == '"' || c == '\\')
+                    e.push_back('\\');
+                e.push_back(c);
+            }
+            return e;
+        };
+
+        static const char* counterKeys[] = { "cycles_per_op", "instructions_per_op", "l1d_misses_per_op", "llc_misses_per_op", "branch_misses_per_op" };
+        os << "{\n  \"benchmarks\": [";
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const auto& r = results[i];
+            const auto& s = r.statistics;
+            os << (i ? ",\n" : "\n") << "    { \"name\": \"" << escaped(r.name) << "\", \"operations\": " << r.operations << ", \"repetitions\": " << r.repetitions
+               << ", \"median_ns\": " << s.median << ", \"mad_ns\": " << s.mad << ", \"p10_ns\": " << s.p10 << ", \"p90_ns\": " << s.p90
+               << ", \"p99_ns\": " << s.p99 << ", \"min_ns\": " << s.min << ", \"max_ns\": " << s.max;
+            if (r.counters.is_available(perf_event::cycles) && r.counters.is_available(perf_event::instructions))
+                os << ", \"ipc\": " << r.counters.ipc();
+            for (std::size_t c = 0; c < perf_counter_values::size; ++c)
+                if (r.counters.available[c])
+                    os << ", \"" << counterKeys[c] << "\": " << r.per_operation(static_cast<perf_event>(c));
+            os << " }";
+        }
+        os << "\n  ]\n}\n";
+    }
+
+    enum class benchmark_verdict
+    {
+        unchanged,
+        improved,
+        regressed
+    };
+
+    //! Compare the median of a benchmark to its baseline. The change is significant when it exceeds both threshold (relative to the
+    //! baseline median) and noise times the summed MADs of the two runs.
+    inline benchmark_verdict compare_benchmark(const benchmark_statistics& baseline, const benchmark_statistics& current, double threshold = 0.05, double noise = 3.0)
+    {
+        auto delta = current.median - baseline.median;
+        if (std::abs(delta) <= threshold * baseline.median || std::abs(delta) <= noise * (baseline.mad + current.mad))
+            return benchmark_verdict::unchanged;
+        return delta > 0 ? benchmark_verdict::regressed : benchmark_verdict::improved;
+    }
+
+    //! Measures the enclosing scope as a benchmark of operations operations and writes the result to os on exit.
+    class benchmark_scope
+    {
+    public:
+
+        benchmark_scope(std::string name, std::size_t operations, std::ostream& os = std::cout)
+            : m_os(os)
+            , m_start()
+        {
+            m_result.name = std::move(name);
+            m_result.operations = operations;
+            m_counters.start();
+            m_start = std::chrono::steady_clock::now();
+        }
+
+        benchmark_scope(const benchmark_scope&) = delete;
+        benchmark_scope& operator=(const benchmark_scope&) = delete;
+
+        ~benchmark_scope()
+        {
+            m_result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+            m_result.counters = m_counters.stop();
+            m_os << m_result << std::endl;
+        }
+
+    private:
+
+        std::ostream&                         m_os;
+        perf_counters                         m_counters;
+        benchmark_result                      m_result;
+        std::chrono::steady_clock::time_point m_start;
+
+    };
+
+}//! namespace stk;
+
+#endif//! STK_UTILITY_BENCHMARK_HPP
@@ -0,0 +1,126 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef STK_UTILITY_DENSE_TYPE_ID_HPP
+#define STK_UTILITY_DENSE_TYPE_ID_HPP
+
+#if defined(_MSC_VER)
+    #pragma once
+#endif
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <typeinfo>
+
+//! The number of types which may register a dense id. Types registered beyond it get ids which are not dispatched by table.
+#ifndef STK_MAX_DENSE_TYPE_IDS
+    #define STK_MAX_DENSE_TYPE_IDS 256
+#endif
+
+namespace stk {
+
+    constexpr std::uint32_t max_dense_type_ids = STK_MAX_DENSE_TYPE_IDS;
+    constexpr std::uint32_t invalid_dense_type_id = ~std::uint32_t(0);
+
+    namespace detail {
+
+        struct dense_type_registry
+        {
+            static dense_type_registry& instance()
+            {
+                static dense_type_registry r;
+                return r;
+            }
+
+            std::uint32_t add(const std::type_info& type)
+            {
+                auto id = next.fetch_add(1, std::memory_order_relaxed);
+                if (id < max_dense_type_ids)
+                    types[id].store(&type, std::memory_order_release);
+                return id;
+            }
+
+            std::atomic<std::uint32_t>                                         next{ 0 };
+            std::array<std::atomic<const std::type_info*>, max_dense_type_ids> types{};
+        };
+
+    }//! namespace detail;
+
+    //! A process wide id for T assigned in order of first use (0, 1, 2, ...) so it may index a table.
+    template <typename T>
+    inline std::uint32_t dense_type_id()
+    {
+        static const std::uint32_t id = detail::dense_type_registry::instance().add(typeid(T));
+        return id;
+    }
+
+    //! The type registered with id (nullptr when there is none.)
+    inline const std::type_info* get_dense_type_info(std::uint32_t id)
+    {
+        return id < max_dense_type_ids ? detail::dense_type_registry::instance().types[id].load(std::memory_order_acquire) : nullptr;
+    }
+
+    //! Detects a polymorphic hierarchy which reports the dense id of the dynamic type with get_dense_type_id().
+    template <typename T, typename EnableIf = void>
+    struct has_dense_type_id : std::false_type {};
+
+    template <typename T>
+    struct has_dense_type_id<T, typename std::enable_if<std::is_same<decltype(std::declval<const T&>().get_dense_type_id()), std::uint32_t>::value>::type> : std::true_type {};
+
+    //! CRTP registration: the root of a hierarchy derives from dense_type_id_base<Root> and each class below it from
+    //! dense_type_id_base<Derived, Parent> (which inherits Parent's constructors.) A class which does not register reports the id of its
+    //! nearest registered ancestor; type_switch detects that (by comparing typeid) and dispatches it by its slower cached path.
+    template <typename Derived, typename Base = void>
+    class dense_type_id_base : public Base
+    {
+    public:
+
+        using Base::Base;
+
+        std::uint32_t get_dense_type_id() const override
+        {
+            return dense_type_id<Derived>();
+        }
+
+    };
+
+    template <typename Derived>
+    class dense_type_id_base<Derived, void>
+    {
+    public:
+
+        virtual ~dense_type_id_base() = default;
+
+        virtual std::uint32_t get_dense_type_id() const
+        {
+            return dense_type_id<Derived>();
+        }
+
+    };
+
+}//! namespace stk;
+
+//! Macro registration for classes which cannot change their bases: STK_DENSE_TYPE_ID_ROOT(Root) in the root class of the hierarchy and
+//! STK_DENSE_TYPE_ID(Derived) in each class below it.
+#define STK_DENSE_TYPE_ID_ROOT(Type)                                 \
+    virtual std::uint32_t get_dense_type_id() const                  \
+    {                                                                \
+        return ::stk::dense_type_id<Type>();                         \
+    }                                                                \
+/***/
+
+#define STK_DENSE_TYPE_ID(Type)                                      \
+    std::uint32_t get_dense_type_id() const override                 \
+    {                                                                \
+        return ::stk::dense_type_id<Type>();                         \
+    }                                                                \
+/***/
+
+#endif//! STK_UTILITY_DENSE_TYPE_ID_HPP
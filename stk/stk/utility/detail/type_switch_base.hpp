@@ -8,13 +8,81 @@
 //
 #pragma once
 
+#include <stk/utility/dense_type_id.hpp>
+#include <stk/container/concurrent_numeric_unordered_map.hpp>
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <type_traits>
+#include <typeinfo>
 
 namespace stk { namespace detail {
 
 	template <typename Derived, std::size_t N>
 	struct type_switch_base;
 
+	//! The case (1 based, 0 when not yet resolved) to which each dynamic type dispatches in the switch Derived. Hierarchies which
+	//! register dense type ids (see dense_type_id.hpp) are looked up by indexing a table; other types (including unregistered classes
+	//! in a registered hierarchy) in a map keyed on their type_info.
+	template <typename Derived>
+	struct type_switch_jump_targets
+	{
+		static stk::concurrent_numeric_unordered_map<std::intptr_t, std::uint64_t>& cached()
+		{
+			static stk::concurrent_numeric_unordered_map<std::intptr_t, std::uint64_t> instance;
+			return instance;
+		}
+
+		static std::array<std::atomic<std::uint32_t>, max_dense_type_ids>& dense()
+		{
+			static std::array<std::atomic<std::uint32_t>, max_dense_type_ids> instance{};
+			return instance;
+		}
+
+		//! The dense id of x's dynamic type or invalid_dense_type_id when it is not registered.
+		template <typename T>
+		static std::uint32_t get_dense_id(T* x)
+		{
+			if constexpr (has_dense_type_id<T>::value)
+			{
+				auto id = x->get_dense_type_id();
+				if (id < max_dense_type_ids && get_dense_type_info(id) == &typeid(*x))
+					return id;
+			}
+			else
+				(void)x;
+			return invalid_dense_type_id;
+		}
+
+		template <typename T>
+		static std::uint64_t find(T* x)
+		{
+			auto id = get_dense_id(x);
+			if (id != invalid_dense_type_id)
+				return dense()[id].load(std::memory_order_relaxed);
+			auto it = cached().find((std::intptr_t)&typeid(*x));
+			return it ? *it : std::uint64_t{};
+		}
+
+		template <typename T>
+		static void assign(T* x, std::uint64_t case_n)
+		{
+			auto id = get_dense_id(x);
+			if (id != invalid_dense_type_id)
+				dense()[id].store(static_cast<std::uint32_t>(case_n), std::memory_order_relaxed);
+			else
+				cached().assign((std::intptr_t)&typeid(*x), case_n);
+		}
+
+		//! Not thread-safe.
+		static void clear()
+		{
+			cached().clear();
+			cached().quiesce();
+			for (auto& c : dense())
+				c.store(0, std::memory_order_relaxed);
+		}
+	};
+
 }}//! namespace stk::detail;
 
@@ -14,25 +14,18 @@ namespace stk { namespace detail {
 	template <typename Derived>
 	struct type_switch_base<Derived, DIMENSION>
 	{
-		static stk::concurrent_numeric_unordered_map<std::intptr_t, std::uint64_t>& jump_targets()
-		{
-			static stk::concurrent_numeric_unordered_map<std::intptr_t, std::uint64_t> instance;
-			return instance;
-		}
+		using jump_targets = type_switch_jump_targets<Derived>;
 
 		//! May be called from a quiescent state to clear the cached jump targets.
 		void clear_jump_targets()
 		{
-			jump_targets().clear();
-			jump_targets().quiesce();
+			jump_targets::clear();
 		}
 
 		template <typename T, typename States>
 		typename std::decay<decltype(std::get<0>(std::declval<States>()))>::type::result_type eval(T* x, States& state)
 		{
-			auto key = (std::intptr_t)&typeid(*x);// vtbl(x);
-			auto it = jump_targets().find(key);
-			auto case_n = it ? *it : std::uint64_t{};
+			auto case_n = jump_targets::find(x);
 			switch (case_n) 
 			{
 				default:
@@ -40,7 +33,7 @@ namespace stk { namespace detail {
 						if (std::get<n>(state).matches(x))                               \
 						{                                                                \
 						    if(case_n == 0)                                              \
-						       jump_targets().assign(key, BOOST_PP_ADD(n,1));            \
+						       jump_targets::assign(x, BOOST_PP_ADD(n,1));              \
 						    case BOOST_PP_ADD(n,1): return std::get<n>(state).invoke(x); \
 						} else                                                           \
 					/***/
@@ -0,0 +1,146 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef STK_UTILITY_FAST_HASH_HPP
+#define STK_UTILITY_FAST_HASH_HPP
+
+#if defined(_MSC_VER)
+    #pragma once
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+    #include <intrin.h>
+    #pragma intrinsic(_umul128)
+#endif
+
+namespace stk {
+
+    namespace fast_hash_detail {
+
+        //! The default secret of wyhash (final version 4, public domain) by Wang Yi.
+        constexpr std::uint64_t secret[4] = { 0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL };
+
+        //! The 128 bit product of a and b as (low, high) in (a, b).
+        inline void mum(std::uint64_t& a, std::uint64_t& b) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            __uint128_t r = a;
+            r *= b;
+            a = static_cast<std::uint64_t>(r);
+            b = static_cast<std::uint64_t>(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+            a = _umul128(a, b, &b);
+#else
+            std::uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<std::uint32_t>(a), lb = static_cast<std::uint32_t>(b);
+            std::uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32), c = t < rl;
+            std::uint64_t lo = t + (rm1 << 32);
+            c += lo < t;
+            b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+            a = lo;
+#endif
+        }
+
+        inline std::uint64_t mix(std::uint64_t a, std::uint64_t b) noexcept
+        {
+            mum(a, b);
+            return a ^ b;
+        }
+
+        //! Unaligned little endian loads (the hash values differ on big endian platforms.)
+        inline std::uint64_t read8(const std::uint8_t* p) noexcept
+        {
+            std::uint64_t v;
+            std::memcpy(&v, p, 8);
+            return v;
+        }
+
+        inline std::uint64_t read4(const std::uint8_t* p) noexcept
+        {
+            std::uint32_t v;
+            std::memcpy(&v, p, 4);
+            return v;
+        }
+
+        inline std::uint64_t read3(const std::uint8_t* p, std::size_t k) noexcept
+        {
+            return (static_cast<std::uint64_t>(p[0]) << 16) | (static_cast<std::uint64_t>(p[k >> 1]) << 8) | p[k - 1];
+        }
+
+    }//! namespace fast_hash_detail;
+
+    //! A fast runtime hash of len bytes (wyhash.) Keys of up to 16 bytes are read with at most four overlapping loads and longer keys
+    //! 16 or 48 bytes per step with the last (partial) block read as the final 16 bytes of the key so there is no byte at a time tail.
+    //! Use fnv1a_hash (string_hash.hpp) for constexpr hashes of literals.
+    inline std::uint64_t fast_hash(const void* key, std::size_t len, std::uint64_t seed = 0) noexcept
+    {
+        using namespace fast_hash_detail;
+        auto p = static_cast<const std::uint8_t*>(key);
+        seed ^= mix(seed ^ secret[0], secret[1]);
+        std::uint64_t a, b;
+        if (len <= 16) {
+            if (len >= 4) {
+                a = (read4(p) << 32) | read4(p + ((len >> 3) << 2));
+                b = (read4(p + len - 4) << 32) | read4(p + len - 4 - ((len >> 3) << 2));
+            }
+            else if (len > 0) {
+                a = read3(p, len);
+                b = 0;
+            }
+            else
+                a = b = 0;
+        }
+        else {
+            auto i = len;
+            if (i > 48) {
+                auto see1 = seed, see2 = seed;
+                do {
+                    seed = mix(read8(p) ^ secret[1], read8(p + 8) ^ seed);
+                    see1 = mix(read8(p + 16) ^ secret[2], read8(p + 24) ^ see1);
+                    see2 = mix(read8(p + 32) ^ secret[3], read8(p + 40) ^ see2);
+                    p += 48;
+                    i -= 48;
+                } while (i > 48);
+                seed ^= see1 ^ see2;
+            }
+            while (i > 16) {
+                seed = mix(read8(p) ^ secret[1], read8(p + 8) ^ seed);
+                i -= 16;
+                p += 16;
+            }
+            a = read8(p + i - 16);
+            b = read8(p + i - 8);
+        }
+
+        a ^= secret[1];
+        b ^= seed;
+        mum(a, b);
+        return mix(a ^ secret[0] ^ len, b ^ secret[1]);
+    }
+
+    inline std::uint64_t fast_hash(std::string_view s, std::uint64_t seed = 0) noexcept
+    {
+        return fast_hash(s.data(), s.size(), seed);
+    }
+
+    //! Hasher for unordered containers of strings.
+    struct fast_string_hash
+    {
+        std::size_t operator()(std::string_view s) const noexcept
+        {
+            return static_cast<std::size_t>(fast_hash(s));
+        }
+    };
+
+}//! namespace stk;
+
+#endif//! STK_UTILITY_FAST_HASH_HPP
@@ -0,0 +1,203 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef STK_UTILITY_PERF_COUNTERS_HPP
+#define STK_UTILITY_PERF_COUNTERS_HPP
+
+#if defined(_MSC_VER)
+    #pragma once
+#endif
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #define STK_HAS_PERF_EVENT_OPEN
+#endif
+
+namespace stk {
+
+    enum class perf_event : std::uint8_t
+    {
+        cycles,
+        instructions,
+        l1d_misses,
+        llc_misses,
+        branch_misses,
+        count
+    };
+
+    inline const char* get_name(perf_event e)
+    {
+        static const char* names[] = { "cycles", "instructions", "L1d misses", "LLC misses", "branch misses" };
+        return names[static_cast<std::size_t>(e)];
+    }
+
+    //! Counter values of a measurement. Counters which could not be opened are not available. When the kernel multiplexes more counters
+    //! than the PMU has, each value is scaled by time enabled / time running.
+    struct perf_counter_values
+    {
+        static constexpr std::size_t size = static_cast<std::size_t>(perf_event::count);
+
+        std::array<double, size> values{};
+        std::array<bool, size>   available{};
+
+        double operator[](perf_event e) const { return values[static_cast<std::size_t>(e)]; }
+        bool   is_available(perf_event e) const { return available[static_cast<std::size_t>(e)]; }
+
+        //! Instructions per cycle (0 when either counter is not available.)
+        double ipc() const
+        {
+            return is_available(perf_event::cycles) && is_available(perf_event::instructions) && (*this)[perf_event::cycles] > 0 ? (*this)[perf_event::instructions] / (*this)[perf_event::cycles] : 0.0;
+        }
+
+        perf_counter_values& operator +=(const perf_counter_values& o)
+        {
+            for (std::size_t i = 0; i < size; ++i) {
+                values[i] += o.values[i];
+                available[i] = available[i] || o.available[i];
+            }
+            return *this;
+        }
+    };
+
+    //! Hardware counters of the calling thread (and of threads it creates while counting) opened with perf_event_open on Linux. Each counter
+    //! is opened separately so the kernel may multiplex them and a counter which is not supported or not permitted (e.g. when
+    //! /proc/sys/kernel/perf_event_paranoid forbids it or in a container) is just reported as not available. Elsewhere no counter is available.
+    class perf_counters
+    {
+    public:
+
+        perf_counters()
+        {
+            m_fds.fill(-1);
+#ifdef STK_HAS_PERF_EVENT_OPEN
+            open(perf_event::cycles, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+            open(perf_event::instructions, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+            open(perf_event::l1d_misses, PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+            open(perf_event::llc_misses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+            open(perf_event::branch_misses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+#endif
+        }
+
+        perf_counters(const perf_counters&) = delete;
+        perf_counters& operator=(const perf_counters&) = delete;
+
+        ~perf_counters()
+        {
+#ifdef STK_HAS_PERF_EVENT_OPEN
+            for (auto fd : m_fds)
+                if (fd != -1)
+                    ::close(fd);
+#endif
+        }
+
+        bool is_available(perf_event e) const { return m_fds[static_cast<std::size_t>(e)] != -1; }
+
+        bool any_available() const
+        {
+            for (auto fd : m_fds)
+                if (fd != -1)
+                    return true;
+            return false;
+        }
+
+        //! Reset and start the counters.
+        void start()
+        {
+#ifdef STK_HAS_PERF_EVENT_OPEN
+            for (auto fd : m_fds) {
+                if (fd != -1) {
+                    ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                    ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+                }
+            }
+#endif
+        }
+
+        //! Stop the counters and read the counts since start().
+        perf_counter_values stop()
+        {
+            perf_counter_values r;
+#ifdef STK_HAS_PERF_EVENT_OPEN
+            for (auto fd : m_fds)
+                if (fd != -1)
+                    ::ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+
+            for (std::size_t i = 0; i < m_fds.size(); ++i) {
+                if (m_fds[i] == -1)
+                    continue;
+                std::uint64_t data[3] = {};//! value, time enabled, time running.
+                if (::read(m_fds[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)))
+                    continue;
+                r.available[i] = true;
+                r.values[i] = data[2] > 0 && data[2] < data[1] ? static_cast<double>(data[0]) * static_cast<double>(data[1]) / static_cast<double>(data[2]) : static_cast<double>(data[0]);
+            }
+#endif
+            return r;
+        }
+
+    private:
+
+#ifdef STK_HAS_PERF_EVENT_OPEN
+        void open(perf_event e, std::uint32_t type, std::uint64_t config)
+        {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = type;
+            attr.config = config;
+            attr.disabled = 1;
+            attr.inherit = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            auto fd = ::syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+            m_fds[static_cast<std::size_t>(e)] = fd < 0 ? -1 : static_cast<int>(fd);
+        }
+#endif
+
+        std::array<int, perf_counter_values::size> m_fds;
+
+    };
+
+    //! Adds the counts of the enclosing scope to values.
+    class perf_counter_scope
+    {
+    public:
+
+        perf_counter_scope(perf_counters& counters, perf_counter_values& values)
+            : m_counters(counters)
+            , m_values(values)
+        {
+            m_counters.start();
+        }
+
+        perf_counter_scope(const perf_counter_scope&) = delete;
+        perf_counter_scope& operator=(const perf_counter_scope&) = delete;
+
+        ~perf_counter_scope()
+        {
+            m_values += m_counters.stop();
+        }
+
+    private:
+
+        perf_counters&       m_counters;
+        perf_counter_values& m_values;
+
+    };
+
+}//! namespace stk;
+
+#endif//! STK_UTILITY_PERF_COUNTERS_HPP
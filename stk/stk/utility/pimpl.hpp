@@ -11,8 +11,11 @@
 #include <boost/checked_delete.hpp>
 #include <boost/config.hpp>
 #include <geometrix/utility/assert.hpp>
+#include <cstddef>
 #include <memory>
+#include <new>
 #include <type_traits>
+#include <utility>
 
 namespace stk{
 
@@ -145,5 +148,72 @@ namespace stk{
         return pimpl<T>(new T(std::forward<Args>(a)...), &detail::deleter<T>, &detail::copier<T>); 
     }
 
+	//! A pimpl which holds T in Size bytes of storage aligned to Align inside the owner rather than on the heap. Only a declaration of
+	//! T is needed here: the constructors, assignments and destructor are defined in pimpl.ipp, which must be included where T is
+	//! complete (and where Size and Align are checked against T at compile time.) So the owner must declare its special members and
+	//! define them in its implementation file (rtree_cache defines them beside its constructor in rtree_cache.ipp); implicit ones
+	//! would be instantiated wherever the owner is copied or destroyed, including translation units which only see its header.
+	//! Unlike pimpl a fast_pimpl always holds a T (a moved from fast_pimpl holds a moved from T) and copies copy the T.
+	template <typename T, std::size_t Size, std::size_t Align = alignof(std::max_align_t)>
+	class fast_pimpl
+	{
+	public:
+
+		using pointer = T*;
+		using const_pointer = const T*;
+		using reference = T&;
+		using const_reference = const T&;
+
+		fast_pimpl();
+
+		template <typename... Args>
+		explicit fast_pimpl(std::in_place_t, Args&&... a);
+
+		fast_pimpl(const fast_pimpl& o);
+		fast_pimpl(fast_pimpl&& o);
+		~fast_pimpl();
+
+		fast_pimpl& operator=(const fast_pimpl& o);
+		fast_pimpl& operator=(fast_pimpl&& o);
+
+		const_pointer operator->() const
+		{
+			return get();
+		}
+
+		pointer operator->()
+		{
+			return get();
+		}
+
+		reference operator*()
+		{
+			return *get();
+		}
+
+		const_reference operator*() const
+		{
+			return *get();
+		}
+
+	private:
+
+		template <std::size_t ActualSize, std::size_t ActualAlign>
+		static void validate();
+
+		pointer get()
+		{
+			return std::launder(reinterpret_cast<pointer>(&m_storage));
+		}
+
+		const_pointer get() const
+		{
+			return std::launder(reinterpret_cast<const_pointer>(&m_storage));
+		}
+
+		alignas(Align) unsigned char m_storage[Size];
+
+	};
+
 }//! namespace stk;
 
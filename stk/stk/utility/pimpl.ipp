@@ -12,5 +12,62 @@
 
 namespace stk{
 
+	//! ActualSize and ActualAlign are sizeof(T) and alignof(T) so they appear in the diagnostic when Size or Align must be changed.
+	template <typename T, std::size_t Size, std::size_t Align>
+	template <std::size_t ActualSize, std::size_t ActualAlign>
+	inline void fast_pimpl<T, Size, Align>::validate()
+	{
+		static_assert(ActualSize <= Size, "fast_pimpl Size must be at least sizeof(T).");
+		static_assert(Align % ActualAlign == 0, "fast_pimpl Align must be a multiple of alignof(T).");
+	}
+
+	template <typename T, std::size_t Size, std::size_t Align>
+	inline fast_pimpl<T, Size, Align>::fast_pimpl()
+	{
+		validate<sizeof(T), alignof(T)>();
+		::new (static_cast<void*>(&m_storage)) T();
+	}
+
+	template <typename T, std::size_t Size, std::size_t Align>
+	template <typename... Args>
+	inline fast_pimpl<T, Size, Align>::fast_pimpl(std::in_place_t, Args&&... a)
+	{
+		validate<sizeof(T), alignof(T)>();
+		::new (static_cast<void*>(&m_storage)) T(std::forward<Args>(a)...);
+	}
+
+	template <typename T, std::size_t Size, std::size_t Align>
+	inline fast_pimpl<T, Size, Align>::fast_pimpl(const fast_pimpl& o)
+	{
+		::new (static_cast<void*>(&m_storage)) T(*o);
+	}
+
+	template <typename T, std::size_t Size, std::size_t Align>
+	inline fast_pimpl<T, Size, Align>::fast_pimpl(fast_pimpl&& o)
+	{
+		::new (static_cast<void*>(&m_storage)) T(std::move(*o));
+	}
+
+	template <typename T, std::size_t Size, std::size_t Align>
+	inline fast_pimpl<T, Size, Align>::~fast_pimpl()
+	{
+		validate<sizeof(T), alignof(T)>();
+		get()->~T();
+	}
+
+	template <typename T, std::size_t Size, std::size_t Align>
+	inline fast_pimpl<T, Size, Align>& fast_pimpl<T, Size, Align>::operator=(const fast_pimpl& o)
+	{
+		**this = *o;
+		return *this;
+	}
+
+	template <typename T, std::size_t Size, std::size_t Align>
+	inline fast_pimpl<T, Size, Align>& fast_pimpl<T, Size, Align>::operator=(fast_pimpl&& o)
+	{
+		**this = std::move(*o);
+		return *this;
+	}
+
 }//! namespace stk;
 
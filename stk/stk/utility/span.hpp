@@ -0,0 +1,139 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include <geometrix/utility/assert.hpp>
+#include <cstddef>
+#include <type_traits>
+#include <iterator>
+
+namespace stk {
+
+    //! A minimal non-owning view over a contiguous sequence. This is a stand-in for std::span with a dynamic extent until the library moves to C++20.
+    template <typename T>
+    class span
+    {
+        template <typename Container>
+        using data_type = decltype(std::declval<Container&>().data());
+
+        template <typename Container>
+        using enable_if_container = typename std::enable_if<!std::is_same<typename std::decay<Container>::type, span>::value && std::is_convertible<typename std::remove_pointer<data_type<Container>>::type(*)[], T(*)[]>::value>::type;
+
+    public:
+
+        using element_type = T;
+        using value_type = typename std::remove_cv<T>::type;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+        using iterator = T*;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+
+        span() = default;
+
+        span(pointer p, size_type n)
+            : m_data(p)
+            , m_size(n)
+        {}
+
+        span(pointer first, pointer last)
+            : m_data(first)
+            , m_size(static_cast<size_type>(last - first))
+        {
+            GEOMETRIX_ASSERT(first <= last);
+        }
+
+        template <std::size_t N>
+        span(element_type (&a)[N])
+            : m_data(a)
+            , m_size(N)
+        {}
+
+        template <typename Container, typename = enable_if_container<Container>>
+        span(Container& c)
+            : m_data(c.data())
+            , m_size(static_cast<size_type>(c.size()))
+        {}
+
+        template <typename Container, typename = enable_if_container<const Container>>
+        span(const Container& c)
+            : m_data(c.data())
+            , m_size(static_cast<size_type>(c.size()))
+        {}
+
+        template <typename U, typename = typename std::enable_if<!std::is_same<U, T>::value && std::is_convertible<U(*)[], T(*)[]>::value>::type>
+        span(const span<U>& o)
+            : m_data(o.data())
+            , m_size(o.size())
+        {}
+
+        pointer   data() const { return m_data; }
+        size_type size() const { return m_size; }
+        size_type size_bytes() const { return m_size * sizeof(T); }
+        bool      empty() const { return m_size == 0; }
+
+        reference operator[](size_type i) const
+        {
+            GEOMETRIX_ASSERT(i < m_size);
+            return m_data[i];
+        }
+
+        reference front() const { GEOMETRIX_ASSERT(!empty()); return m_data[0]; }
+        reference back() const { GEOMETRIX_ASSERT(!empty()); return m_data[m_size - 1]; }
+
+        iterator         begin() const { return m_data; }
+        iterator         end() const { return m_data + m_size; }
+        reverse_iterator rbegin() const { return reverse_iterator(end()); }
+        reverse_iterator rend() const { return reverse_iterator(begin()); }
+
+        span first(size_type n) const
+        {
+            GEOMETRIX_ASSERT(n <= m_size);
+            return span(m_data, n);
+        }
+
+        span last(size_type n) const
+        {
+            GEOMETRIX_ASSERT(n <= m_size);
+            return span(m_data + (m_size - n), n);
+        }
+
+        span subspan(size_type offset, size_type count = static_cast<size_type>(-1)) const
+        {
+            GEOMETRIX_ASSERT(offset <= m_size);
+            return span(m_data + offset, count == static_cast<size_type>(-1) ? m_size - offset : count);
+        }
+
+    private:
+
+        pointer   m_data{ nullptr };
+        size_type m_size{ 0 };
+
+    };
+
+    template <typename Container>
+    span(Container&) -> span<typename std::remove_pointer<decltype(std::declval<Container&>().data())>::type>;
+
+    template <typename Container>
+    span(const Container&) -> span<typename std::remove_pointer<decltype(std::declval<const Container&>().data())>::type>;
+
+    template <typename T>
+    inline span<T> make_span(T* p, std::size_t n)
+    {
+        return span<T>(p, n);
+    }
+
+    template <typename Container>
+    inline auto make_span(Container& c) -> span<typename std::remove_pointer<decltype(c.data())>::type>
+    {
+        return { c.data(), static_cast<std::size_t>(c.size()) };
+    }
+
+}//! namespace stk;
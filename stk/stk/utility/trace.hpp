@@ -0,0 +1,402 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef STK_UTILITY_TRACE_HPP
+#define STK_UTILITY_TRACE_HPP
+
+#if defined(_MSC_VER)
+    #pragma once
+#endif
+
+#include <geometrix/utility/assert.hpp>
+#include <boost/preprocessor/cat.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86)
+    #include <intrin.h>
+    #define STK_TRACE_HAS_RDTSC
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    #define STK_TRACE_HAS_RDTSC
+#endif
+
+//! Events each thread may hold before the flusher drains them. Events recorded while a thread's ring is full are dropped and counted.
+#ifndef STK_TRACE_RING_CAPACITY
+    #define STK_TRACE_RING_CAPACITY 16384
+#endif
+
+namespace stk { namespace trace {
+
+    //! Timestamps in ticks of the TSC where available (else steady_clock nanoseconds.)
+    inline std::uint64_t now()
+    {
+#ifdef STK_TRACE_HAS_RDTSC
+        return __rdtsc();
+#else
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    //! Calibrated against steady_clock on the first call (which takes ~20ms on TSC platforms.)
+    inline double ticks_per_microsecond()
+    {
+#ifdef STK_TRACE_HAS_RDTSC
+        static const double ticks = []()
+        {
+            auto start = std::chrono::steady_clock::now();
+            auto t0 = now();
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            auto t1 = now();
+            auto us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+            return static_cast<double>(t1 - t0) / us;
+        }();
+        return ticks;
+#else
+        return 1000.0;
+#endif
+    }
+
+    //! A completed zone. The name must have static storage duration (e.g. a string literal.)
+    struct event
+    {
+        const char*   name;
+        std::uint64_t begin;
+        std::uint64_t end;
+    };
+
+    //! Single producer (the owning thread) single consumer (the flusher) ring of events.
+    class event_ring
+    {
+    public:
+
+        static constexpr std::size_t capacity = STK_TRACE_RING_CAPACITY;
+        static_assert((capacity & (capacity - 1)) == 0, "STK_TRACE_RING_CAPACITY must be a power of 2.");
+
+        explicit event_ring(std::uint32_t threadIndex)
+            : m_events(new event[capacity])
+            , m_threadIndex(threadIndex)
+        {}
+
+        void push(const event& e) noexcept
+        {
+            auto head = m_head.load(std::memory_order_relaxed);
+            if (head - m_tail.load(std::memory_order_acquire) == capacity) {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            m_events[head & (capacity - 1)] = e;
+            m_head.store(head + 1, std::memory_order_release);
+        }
+
+        //! Call fn(event) for each event recorded so far. Returns the number drained.
+        template <typename Fn>
+        std::size_t drain(Fn&& fn)
+        {
+            auto tail = m_tail.load(std::memory_order_relaxed);
+            auto head = m_head.load(std::memory_order_acquire);
+            for (auto i = tail; i != head; ++i)
+                fn(m_events[i & (capacity - 1)]);
+            m_tail.store(head, std::memory_order_release);
+            return head - tail;
+        }
+
+        std::uint32_t get_thread_index() const { return m_threadIndex; }
+        std::size_t   get_dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+    private:
+
+        std::unique_ptr<event[]>         m_events;
+        alignas(64) std::atomic<std::size_t> m_head{ 0 };
+        alignas(64) std::atomic<std::size_t> m_tail{ 0 };
+        std::atomic<std::size_t>         m_dropped{ 0 };
+        std::uint32_t                    m_threadIndex;
+
+    };
+
+    //! Output format of the collected events.
+    class trace_writer
+    {
+    public:
+
+        virtual ~trace_writer() = default;
+        virtual void write(const event& e, std::uint32_t threadIndex) = 0;
+        virtual void finish() = 0;
+
+    };
+
+    //! Chrome trace event JSON (complete events) which loads in chrome://tracing and Perfetto. Times are written as fixed point
+    //! microseconds with nanosecond resolution however far the events are from the origin.
+    class chrome_trace_writer : public trace_writer
+    {
+    public:
+
+        chrome_trace_writer(std::ostream& os, std::uint64_t origin)
+            : m_os(os)
+            , m_origin(origin)
+            , m_ticksPerUs(ticks_per_microsecond())
+        {
+            m_os << "{\"traceEvents\":[";
+        }
+
+        void write(const event& e, std::uint32_t threadIndex) override
+        {
+            auto ts = static_cast<double>(static_cast<std::int64_t>(e.begin - m_origin)) / m_ticksPerUs;
+            auto dur = static_cast<double>(e.end - e.begin) / m_ticksPerUs;
+            m_os << (m_first ? "\n" : ",\n") << "{\"name\":\"";
+            for (auto c = e.name; *c; ++c) {
+                if (*c == '"' || *c == '\\')
+                    m_os << '\\';
+                m_os << *c;
+            }
+            auto flags = m_os.flags();
+            auto precision = m_os.precision();
+            m_os << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << threadIndex << std::fixed << std::setprecision(3) << ",\"ts\":" << ts << ",\"dur\":" << dur << "}";
+            m_os.flags(flags);
+            m_os.precision(precision);
+            m_first = false;
+        }
+
+        void finish() override
+        {
+            m_os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+            m_os.flush();
+        }
+
+    private:
+
+        std::ostream& m_os;
+        std::uint64_t m_origin;
+        double        m_ticksPerUs;
+        bool          m_first{ true };
+
+    };
+
+    //! Compact binary format: the header "STKTRACE" followed by ticks per microsecond (double) and the origin tick (uint64), then records:
+    //! 'N' uint32 id, uint32 length, name bytes (the first time a name is seen); 'E' uint32 thread, uint32 name id, uint64 begin, uint64 end.
+    //! Values are in native byte order.
+    class binary_trace_writer : public trace_writer
+    {
+    public:
+
+        binary_trace_writer(std::ostream& os, std::uint64_t origin)
+            : m_os(os)
+        {
+            double ticksPerUs = ticks_per_microsecond();
+            m_os.write("STKTRACE", 8);
+            put(ticksPerUs);
+            put(origin);
+        }
+
+        void write(const event& e, std::uint32_t threadIndex) override
+        {
+            auto it = m_names.find(e.name);
+            if (it == m_names.end()) {
+                it = m_names.emplace(e.name, static_cast<std::uint32_t>(m_names.size())).first;
+                auto length = static_cast<std::uint32_t>(std::strlen(e.name));
+                m_os.put('N');
+                put(it->second);
+                put(length);
+                m_os.write(e.name, length);
+            }
+
+            m_os.put('E');
+            put(threadIndex);
+            put(it->second);
+            put(e.begin);
+            put(e.end);
+        }
+
+        void finish() override
+        {
+            m_os.flush();
+        }
+
+    private:
+
+        template <typename T>
+        void put(const T& v)
+        {
+            m_os.write(reinterpret_cast<const char*>(&v), sizeof(T));
+        }
+
+        std::ostream&                                   m_os;
+        std::unordered_map<const char*, std::uint32_t>  m_names;
+
+    };
+
+    //! Registry of the per thread rings and the background flusher.
+    class collector
+    {
+    public:
+
+        static collector& instance()
+        {
+            static collector c;
+            return c;
+        }
+
+        //! The ring of the calling thread (registered on first use.)
+        static event_ring& local_ring()
+        {
+            static thread_local std::shared_ptr<event_ring> ring = instance().register_thread();
+            return *ring;
+        }
+
+        std::uint64_t get_origin() const { return m_origin; }
+
+        //! Start a thread which drains the rings into writer every interval until stop().
+        void start(std::unique_ptr<trace_writer> writer, std::chrono::milliseconds interval = std::chrono::milliseconds(50))
+        {
+            stop();
+            {
+                std::unique_lock<std::mutex> lk{ m_drainMutex };
+                m_writer = std::move(writer);
+            }
+            m_stop = false;
+            m_flusher = std::thread([this, interval]()
+            {
+                std::unique_lock<std::mutex> lk{ m_flusherMutex };
+                while (!m_stop) {
+                    m_flusherCnd.wait_for(lk, interval, [this]() { return m_stop; });
+                    lk.unlock();
+                    flush();
+                    lk.lock();
+                }
+            });
+        }
+
+        //! Stop the flusher, drain the remaining events and finish the output.
+        void stop()
+        {
+            if (m_flusher.joinable()) {
+                {
+                    std::unique_lock<std::mutex> lk{ m_flusherMutex };
+                    m_stop = true;
+                }
+                m_flusherCnd.notify_one();
+                m_flusher.join();
+            }
+
+            flush();
+            std::unique_lock<std::mutex> lk{ m_drainMutex };
+            if (m_writer) {
+                m_writer->finish();
+                m_writer.reset();
+            }
+        }
+
+        //! Drain the rings into the writer (events are discarded when there is none.) Returns the number of events drained.
+        std::size_t flush()
+        {
+            std::vector<std::shared_ptr<event_ring>> rings;
+            {
+                std::unique_lock<std::mutex> lk{ m_registryMutex };
+                rings = m_rings;
+            }
+
+            std::unique_lock<std::mutex> lk{ m_drainMutex };
+            std::size_t n = 0;
+            for (auto& r : rings) {
+                auto tid = r->get_thread_index();
+                if (m_writer)
+                    n += r->drain([this, tid](const event& e) { m_writer->write(e, tid); });
+                else
+                    n += r->drain([](const event&) {});
+            }
+            return n;
+        }
+
+        std::size_t get_dropped() const
+        {
+            std::unique_lock<std::mutex> lk{ m_registryMutex };
+            std::size_t n = 0;
+            for (auto& r : m_rings)
+                n += r->get_dropped();
+            return n;
+        }
+
+    private:
+
+        collector()
+            : m_origin(now())
+        {}
+
+        ~collector()
+        {
+            stop();
+        }
+
+        std::shared_ptr<event_ring> register_thread()
+        {
+            std::unique_lock<std::mutex> lk{ m_registryMutex };
+            m_rings.push_back(std::make_shared<event_ring>(static_cast<std::uint32_t>(m_rings.size())));
+            return m_rings.back();
+        }
+
+        std::uint64_t                             m_origin;
+        mutable std::mutex                        m_registryMutex;
+        std::vector<std::shared_ptr<event_ring>>  m_rings;
+        std::mutex                                m_drainMutex;
+        std::unique_ptr<trace_writer>             m_writer;
+        std::mutex                                m_flusherMutex;
+        std::condition_variable                   m_flusherCnd;
+        bool                                      m_stop{ false };
+        std::thread                               m_flusher;
+
+    };
+
+    //! Records the zone from construction to destruction in the calling thread's ring.
+    class scope
+    {
+    public:
+
+        explicit scope(const char* name) noexcept
+            : m_name(name)
+            , m_begin(now())
+        {}
+
+        scope(const scope&) = delete;
+        scope& operator=(const scope&) = delete;
+
+        ~scope()
+        {
+            collector::local_ring().push(event{ m_name, m_begin, now() });
+        }
+
+    private:
+
+        const char*   m_name;
+        std::uint64_t m_begin;
+
+    };
+
+}}//! namespace stk::trace;
+
+//! STK_TRACE_SCOPE("name") records a zone for the rest of the enclosing scope when STK_ENABLE_TRACING is defined and compiles away otherwise.
+//! STK_ENABLE_TRACING must be defined consistently for every translation unit of a program (set the STK_ENABLE_TRACING CMake option
+//! rather than defining it in a source file): the zones are expanded in inline and template functions such as those of
+//! work_stealing_thread_pool, so mixing traced and untraced translation units gives them differing definitions (an ODR violation.)
+#ifdef STK_ENABLE_TRACING
+    #define STK_TRACE_SCOPE(name) ::stk::trace::scope BOOST_PP_CAT(stk_trace_scope_, __LINE__)(name)
+#else
+    #define STK_TRACE_SCOPE(name)
+#endif
+
+#endif//! STK_UTILITY_TRACE_HPP
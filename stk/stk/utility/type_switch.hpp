@@ -117,6 +117,9 @@ namespace stk{
         return type_switch_default<typename detail::lambda_traits<Fn>::type, Fn>{std::forward<Fn>(fn)};
     }
 
+    //! Dispatches a pointer to the first case whose type its dynamic type converts to (by dynamic_cast the first time each dynamic type
+    //! is seen.) The resolved case is cached per dynamic type: in a table indexed by the dense type id for hierarchies which register
+    //! one (see dense_type_id.hpp), making the dispatch a virtual call and an indexed switch, and otherwise in a map keyed on type_info.
     template <typename... Types>
     class type_switch : detail::type_switch_base<type_switch<Types...>, sizeof...(Types)>
     {
@@ -22,6 +22,7 @@
 #include <stk/thread/concurrentqueue.h>
 #include <stk/thread/concurrentqueue_queue_info_no_tokens.h>
 #include <stk/thread/seq_executor.hpp>
+#include <stk/random/sobol_sequence.hpp>
 
 #include <exact/predicates.hpp>
 
@@ -223,7 +224,16 @@ TEST(biased_position_generator_test_suite, polygon_with_holes_test)
 		//! These are for drawing via GraphicalDebugging plugin on visual studio... ignore.
 		rs.emplace_back(p, 0.1 * units::si::meters);
 	}
-	EXPECT_TRUE(true);
+
+	//! Low-discrepancy spawn positions from a scrambled Sobol sequence.
+	rs.clear();
+	stk::sobol_sequence<3> sobol{ 42 };
+	for (auto i = 0; i < 512; ++i)
+	{
+		auto p = bpg2.get_random_position<point2>(sobol);
+		rs.emplace_back(p, 0.1 * units::si::meters);
+	}
+	EXPECT_EQ(512ULL, sobol.position());
 }
 
 TEST(bsp_test_suite, point_in_solid_classification_test)
@@ -0,0 +1,147 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <stk/container/double_buffered_soa.hpp>
+#include <stk/geometry/geometry_kernel.hpp>
+#include <stk/container/collision_grid.hpp>
+#include <stk/thread/work_stealing_thread_pool.hpp>
+#include <stk/thread/concurrentqueue.h>
+#include <stk/thread/concurrentqueue_queue_info_no_tokens.h>
+#include <geometrix/utility/scope_timer.ipp>
+#include <atomic>
+#include <vector>
+
+using mc_queue_traits = moodycamel_concurrent_queue_traits_no_tokens;
+
+namespace {
+	struct position { double x{ 0 }; };
+	struct velocity { double v{ 0 }; };
+	struct mood { int value{ 0 }; };
+	struct location { stk::point2 p; };
+	struct neighbours { std::size_t count{ 0 }; };
+}
+
+TEST(double_buffered_soa_test_suite, writes_are_published_at_swap)
+{
+	stk::double_buffered_soa<position, velocity, mood> state(4);
+	for (std::size_t i = 0; i < state.size(); ++i)
+		state.set(i, velocity{ 1.0 + i });
+
+	auto pos = state.back<position>();
+	for (std::size_t i = 0; i < state.size(); ++i)
+		pos[i].x = state.front<position>(i).x + state.front<velocity>(i).v;
+
+	//! Reads see the previous tick until the swap.
+	EXPECT_EQ(0.0, state.front<position>(3).x);
+	EXPECT_TRUE(state.is_dirty<position>());
+	EXPECT_FALSE(state.is_dirty<velocity>());
+	state.swap_buffers();
+	EXPECT_FALSE(state.is_dirty<position>());
+	EXPECT_EQ(4.0, state.front<position>(3).x);
+
+	//! The new back buffer starts as a copy of the front.
+	EXPECT_EQ(4.0, state.back<position>()[3].x);
+	EXPECT_EQ(4.0, state.front<velocity>(3).v);
+}
+
+TEST(double_buffered_soa_test_suite, parallel_neighbour_update_is_consistent)
+{
+	//! Each agent moves to the average of its neighbours on a ring. With double buffering the result is independent of the update order.
+	stk::thread::work_stealing_thread_pool<mc_queue_traits> pool;
+	std::size_t n = 100000;
+	stk::double_buffered_soa<position, mood> state(n);
+	std::vector<double> expected(n);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		state.set(i, position{ static_cast<double>(i % 100) });
+		expected[i] = static_cast<double>(i % 100);
+	}
+
+	for (auto tick = 0; tick < 10; ++tick)
+	{
+		{
+			GEOMETRIX_MEASURE_SCOPE_TIME("double_buffered_soa parallel_update");
+			state.parallel_update<position, mood>(pool, [n](std::size_t i, const stk::double_buffered_soa<position, mood>::front_view& front, position& p, mood& m)
+			{
+				auto l = front.get<position>((i + n - 1) % n).x;
+				auto r = front.get<position>((i + 1) % n).x;
+				p.x = 0.5 * (l + r);
+				m.value = front.get<mood>(i).value + 1;
+			}, 4096);
+			state.swap_buffers(pool);
+		}
+
+		std::vector<double> next(n);
+		for (std::size_t i = 0; i < n; ++i)
+			next[i] = 0.5 * (expected[(i + n - 1) % n] + expected[(i + 1) % n]);
+		expected.swap(next);
+	}
+
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		ASSERT_EQ(expected[i], state.front<position>(i).x);
+		ASSERT_EQ(10, state.front<mood>(i).value);
+	}
+}
+
+TEST(double_buffered_soa_test_suite, collision_grid_neighbour_queries_read_the_front)
+{
+	//! Agents are binned in a collision_grid and each reads the locations of the agents in the cells around it while moving itself. Every
+	//! read must see the location from before the tick even when the neighbour has already written its new one.
+	using namespace stk;
+	using namespace boost::units::si;
+	struct cell { std::vector<std::size_t> agents; };
+
+	stk::thread::work_stealing_thread_pool<mc_queue_traits> pool;
+	std::size_t nPerCell = 4, width = 10, n = nPerCell * width * width;
+	geometrix::grid_traits<units::length> traits(0.0 * meters, 3.0 * width * meters, 0.0 * meters, 3.0 * width * meters, 3.0 * meters);
+	collision_grid<cell> grid{ traits };
+	double_buffered_soa<location, neighbours> state(n);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		auto k = i / nPerCell;
+		auto x = 3.0 * (k % width) + 0.5 + 0.5 * (i % nPerCell);
+		auto y = 3.0 * (k / width) + 1.5;
+		state.set(i, location{ point2{ x * meters, y * meters } });
+		grid.visit(segment2{ point2{ x * meters, y * meters }, point2{ (x + 0.1) * meters, y * meters } }, [i](cell& c) { c.agents.push_back(i); });
+	}
+
+	for (auto tick = 0; tick < 3; ++tick)
+	{
+		std::vector<location> before(state.front<location>().begin(), state.front<location>().end());
+		std::atomic<std::size_t> stale{ 0 };
+		state.parallel_update<location, neighbours>(pool, [&](std::size_t i, const double_buffered_soa<location, neighbours>::front_view& front, location& l, neighbours& nb)
+		{
+			auto p = front.get<location>(i).p;
+			nb.count = 0;
+			grid.visit(point2(p), 3.0 * meters, [&](cell& c)
+			{
+				for (auto j : c.agents)
+				{
+					const auto& q = front.get<location>(j).p;
+					if (geometrix::get<0>(q) != geometrix::get<0>(before[j].p) || geometrix::get<1>(q) != geometrix::get<1>(before[j].p))
+						++stale;
+					++nb.count;
+				}
+			});
+			l.p = point2{ geometrix::get<0>(p) + 0.01 * meters, geometrix::get<1>(p) };
+		}, 16);
+		state.swap_buffers();
+
+		EXPECT_EQ(0u, stale.load());
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			ASSERT_LE(nPerCell, state.front<neighbours>(i).count);
+			ASSERT_EQ(geometrix::get<0>(before[i].p) + 0.01 * meters, geometrix::get<0>(state.front<location>(i).p));
+		}
+	}
+}
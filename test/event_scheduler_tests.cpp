@@ -0,0 +1,249 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <stk/container/calendar_queue.hpp>
+#include <stk/sim/event_scheduler.hpp>
+#include <stk/thread/work_stealing_thread_pool.hpp>
+#include <stk/thread/concurrentqueue.h>
+#include <stk/thread/concurrentqueue_queue_info_no_tokens.h>
+#include <geometrix/utility/scope_timer.ipp>
+#include <functional>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+using mc_queue_traits = moodycamel_concurrent_queue_traits_no_tokens;
+
+TEST(calendar_queue_test_suite, pops_in_time_then_fifo_order)
+{
+	stk::calendar_queue<int> q;
+	std::mt19937 gen(13);
+	std::uniform_int_distribution<int> U(0, 500);
+	std::vector<std::pair<double, int>> expected;
+	for (auto i = 0; i < 5000; ++i)
+	{
+		//! Coarse times produce many ties.
+		auto t = 0.25 * U(gen);
+		q.push(t, i);
+		expected.emplace_back(t, i);
+	}
+
+	std::stable_sort(expected.begin(), expected.end(), [](const std::pair<double, int>& a, const std::pair<double, int>& b) { return a.first < b.first; });
+	for (const auto& e : expected)
+	{
+		ASSERT_FALSE(q.empty());
+		auto r = q.pop();
+		EXPECT_EQ(e.first, r.time);
+		EXPECT_EQ(e.second, r.value);
+	}
+	EXPECT_TRUE(q.empty());
+}
+
+TEST(calendar_queue_test_suite, hold_model_matches_binary_heap)
+{
+	//! The hold model: pop the earliest event and push a new one at its time plus an exponential increment with a constant queue size.
+	std::size_t size = 10000;
+	std::size_t holds = 1000000;
+	std::exponential_distribution<double> increment(1.0);
+
+	using heap_entry = std::pair<double, std::uint64_t>;
+	std::priority_queue<heap_entry, std::vector<heap_entry>, std::greater<heap_entry>> heap;
+	stk::calendar_queue<std::uint64_t> calendar;
+	std::mt19937 gen0(42), gen1(42);
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		heap.emplace(increment(gen0), i);
+		calendar.push(increment(gen1), i);
+	}
+
+	double heapSum = 0.0, calendarSum = 0.0;
+	{
+		GEOMETRIX_MEASURE_SCOPE_TIME("hold model binary heap");
+		for (std::size_t i = 0; i < holds; ++i)
+		{
+			auto e = heap.top();
+			heap.pop();
+			heapSum += e.first;
+			heap.emplace(e.first + increment(gen0), e.second);
+		}
+	}
+	{
+		GEOMETRIX_MEASURE_SCOPE_TIME("hold model calendar queue");
+		for (std::size_t i = 0; i < holds; ++i)
+		{
+			auto e = calendar.pop();
+			calendarSum += e.time;
+			calendar.push(e.time + increment(gen1), e.value);
+		}
+	}
+
+	EXPECT_EQ(heapSum, calendarSum);
+	EXPECT_EQ(heap.size(), calendar.size());
+}
+
+TEST(event_scheduler_test_suite, events_run_in_order_and_cancel)
+{
+	stk::event_scheduler<> sim;
+	std::vector<int> order;
+	sim.schedule(2.0, [&] { order.push_back(2); });
+	auto h = sim.schedule(1.5, [&] { order.push_back(15); });
+	sim.schedule(1.0, [&]
+	{
+		order.push_back(1);
+		sim.schedule_in(0.25, [&] { order.push_back(125); });
+	});
+	sim.schedule(1.0, [&] { order.push_back(10); });
+
+	EXPECT_TRUE(sim.is_pending(h));
+	EXPECT_TRUE(sim.cancel(h));
+	EXPECT_FALSE(sim.cancel(h));
+	EXPECT_FALSE(sim.is_pending(h));
+
+	EXPECT_EQ(2, sim.run_until(1.0));
+	EXPECT_EQ(1.0, sim.now());
+	EXPECT_EQ(2, sim.get_number_pending());
+	EXPECT_EQ(2, sim.run());
+	EXPECT_THAT(order, ::testing::ElementsAre(1, 10, 125, 2));
+	EXPECT_TRUE(sim.empty());
+
+	//! A stale handle does not cancel the event now occupying its slot.
+	sim.schedule(3.0, [&] { order.push_back(3); });
+	EXPECT_FALSE(sim.cancel(h));
+	sim.run();
+	EXPECT_EQ(3, order.back());
+}
+
+namespace {
+	//! Entities which reschedule themselves at coarse times (so many events share a timestamp) and occasionally cancel and postpone their
+	//! next event.
+	struct entity_model
+	{
+		entity_model(stk::event_scheduler<>& sim, std::size_t n)
+			: sim(sim)
+			, state(n, 0)
+			, handles(n)
+		{
+			for (std::size_t i = 0; i < n; ++i)
+				handles[i] = sim.schedule(static_cast<double>(i % 7), [this, i] { step(i); }, i);
+		}
+
+		void step(std::size_t i)
+		{
+			//! A cheap deterministic update of this entity only.
+			state[i] = state[i] * 6364136223846793005ULL + 1442695040888963407ULL + static_cast<std::uint64_t>(sim.now());
+			auto next = sim.now() + static_cast<double>(1 + state[i] % 5);
+			if (next < 200.0)
+			{
+				handles[i] = sim.schedule(next, [this, i] { step(i); }, i);
+				if (state[i] % 4 == 0)
+				{
+					EXPECT_TRUE(sim.cancel(handles[i]));
+					handles[i] = sim.schedule(next + 1.0, [this, i] { step(i); }, i);
+				}
+			}
+		}
+
+		stk::event_scheduler<>&         sim;
+		std::vector<std::uint64_t>      state;
+		std::vector<stk::event_handle>  handles;
+	};
+}
+
+TEST(event_scheduler_test_suite, parallel_dispatch_matches_serial)
+{
+	stk::thread::work_stealing_thread_pool<mc_queue_traits> pool;
+	std::size_t n = 2000;
+
+	stk::event_scheduler<> serialSim;
+	entity_model serial(serialSim, n);
+	auto serialCount = 0UL;
+	{
+		GEOMETRIX_MEASURE_SCOPE_TIME("event_scheduler serial");
+		serialCount = serialSim.run();
+	}
+
+	stk::event_scheduler<> parallelSim;
+	entity_model parallel(parallelSim, n);
+	auto parallelCount = 0UL;
+	{
+		GEOMETRIX_MEASURE_SCOPE_TIME("event_scheduler parallel");
+		parallelCount = parallelSim.run(pool);
+	}
+
+	EXPECT_EQ(serialCount, parallelCount);
+	EXPECT_EQ(serial.state, parallel.state);
+	EXPECT_EQ(serialSim.now(), parallelSim.now());
+}
+
+namespace {
+	//! Same time events A (key 1), B (key 2) and C (key 1) each schedule an unkeyed follow up.
+	template <typename Run>
+	std::vector<char> run_follow_ups(Run run)
+	{
+		stk::event_scheduler<> sim;
+		std::vector<char> order;
+		sim.schedule(0.0, [&] { sim.schedule(1.0, [&] { order.push_back('x'); }); }, 1);
+		sim.schedule(0.0, [&] { sim.schedule(1.0, [&] { order.push_back('y'); }); }, 2);
+		sim.schedule(0.0, [&] { sim.schedule(1.0, [&] { order.push_back('z'); }); }, 1);
+		run(sim);
+		return order;
+	}
+
+	//! A cancels C (same time and key) and B (another key) runs concurrently.
+	template <typename Run>
+	std::vector<std::string> run_cancel_same_timestamp(Run run)
+	{
+		stk::event_scheduler<> sim;
+		std::vector<std::string> order;
+		stk::event_handle c;
+		sim.schedule(0.0, [&] { order.push_back(sim.cancel(c) ? "A+" : "A-"); }, 1);
+		sim.schedule(0.0, [] {}, 2);
+		c = sim.schedule(0.0, [&] { order.push_back("C"); }, 1);
+		EXPECT_EQ(2, run(sim));
+		EXPECT_TRUE(sim.empty());
+		return order;
+	}
+}
+
+TEST(event_scheduler_test_suite, parallel_follow_ups_are_sequenced_as_serial)
+{
+	stk::thread::work_stealing_thread_pool<mc_queue_traits> pool;
+	auto serial = run_follow_ups([](stk::event_scheduler<>& sim) { return sim.run(); });
+	auto parallel = run_follow_ups([&pool](stk::event_scheduler<>& sim) { return sim.run(pool); });
+	EXPECT_THAT(serial, ::testing::ElementsAre('x', 'y', 'z'));
+	EXPECT_EQ(serial, parallel);
+}
+
+TEST(event_scheduler_test_suite, parallel_handler_cancels_event_of_same_timestamp)
+{
+	stk::thread::work_stealing_thread_pool<mc_queue_traits> pool;
+	auto serial = run_cancel_same_timestamp([](stk::event_scheduler<>& sim) { return sim.run(); });
+	auto parallel = run_cancel_same_timestamp([&pool](stk::event_scheduler<>& sim) { return sim.run(pool); });
+	EXPECT_THAT(serial, ::testing::ElementsAre("A+"));
+	EXPECT_EQ(serial, parallel);
+}
+
+TEST(event_scheduler_test_suite, parallel_handler_schedules_on_another_scheduler)
+{
+	stk::thread::work_stealing_thread_pool<mc_queue_traits> pool;
+	stk::event_scheduler<> sim, other;
+	auto ran = false;
+	sim.schedule(0.0, [&] { other.schedule(1.0, [&] { ran = true; }); }, 1);
+	sim.schedule(0.0, [] {}, 2);
+
+	EXPECT_EQ(2, sim.run(pool));
+	EXPECT_TRUE(sim.empty());
+	EXPECT_EQ(1, other.get_number_pending());
+	EXPECT_EQ(1, other.run());
+	EXPECT_TRUE(ran);
+}
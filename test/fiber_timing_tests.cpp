@@ -25,6 +25,7 @@
 #include <boost/context/stack_traits.hpp>
 
 #include <geometrix/utility/scope_timer.ipp>
+#include <stk/utility/benchmark.hpp>
 
 #include <stk/thread/concurrentqueue.h>
 #include <stk/thread/concurrentqueue_queue_info.h>
@@ -52,6 +53,7 @@ void bash_overhead(Pool& pool, const char* name)
 	fs.reserve(100000);
 	{
 		GEOMETRIX_MEASURE_SCOPE_TIME(name);
+		stk::benchmark_scope bench(name, 100000);
 		for (unsigned i = 0; i < 100000; ++i) 
 			fs.emplace_back(pool.send([]() -> void { }));
 		boost::for_each(fs, [](const future_t& f) { f.wait(); });
@@ -76,6 +78,7 @@ void bash_map_sequential(const char* name)
 
 	{
 		GEOMETRIX_MEASURE_SCOPE_TIME(name);
+		stk::benchmark_scope bench(name, 100000 * nsubwork * 3);
 		for (unsigned i = 0; i < 100000; ++i) {
 			for (int q = 0; q < nsubwork; ++q)
 			{
@@ -113,6 +116,7 @@ void bash_map(Pool& pool, const char* name)
 	fs.reserve(100000);
 	{
 		GEOMETRIX_MEASURE_SCOPE_TIME(name);
+		stk::benchmark_scope bench(name, 100000 * nsubwork * 3);
 		for (unsigned i = 0; i < 100000; ++i) {
 			fs.emplace_back(pool.send([&m, i]() -> void 
 			{
@@ -156,6 +160,7 @@ void bash_junction_map(Pool& pool, const char* name)
 	fs.reserve(100000);
 	{
 		GEOMETRIX_MEASURE_SCOPE_TIME(name);
+		stk::benchmark_scope bench(name, 100000 * nsubwork * 3);
 		for (unsigned i = 2; i < 100000 + 2; ++i) {
 			fs.emplace_back(pool.send([&m, i]() -> void
 			{
@@ -198,6 +203,7 @@ void bash_synchronized_map(Pool& pool, const char* name)
 	fs.reserve(100000);
 	{
 		GEOMETRIX_MEASURE_SCOPE_TIME(name);
+		stk::benchmark_scope bench(name, 100000 * nsubwork * 3);
 		for (unsigned i = 0; i < 100000; ++i) {
 			fs.emplace_back(pool.send([&m, &mtx, i]() -> void
 			{
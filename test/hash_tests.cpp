@@ -2,6 +2,13 @@
 #include <gmock/gmock.h>
 
 #include <stk/utility/string_hash.hpp>
+#include <stk/utility/fast_hash.hpp>
+#include <stk/container/string_interner.hpp>
+
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
 
 TEST( string_hash_test_suite, construct_hash )
 {
@@ -77,3 +84,122 @@ TEST( string_hash_test_suite, run_time_construct_string_hash )
 	EXPECT_EQ( s32.hash(), 2833342361u );
 	EXPECT_EQ( s64.hash(), 9716672729628056121u );
 }
+
+TEST( fast_hash_test_suite, matches_wyhash_reference_values )
+{
+	using namespace stk;
+
+	EXPECT_EQ( fast_hash( "", 0, 0 ), 0x93228a4de0eec5a2ull );
+	EXPECT_EQ( fast_hash( "a", 1, 1 ), 0xc5bac3db178713c4ull );
+	EXPECT_EQ( fast_hash( "abc", 3, 2 ), 0xa97f2f7b1d9b3314ull );
+	EXPECT_EQ( fast_hash( "message digest", 14, 3 ), 0x786d1f1df3801df4ull );
+	EXPECT_EQ( fast_hash( "abcdefghijklmnopqrstuvwxyz", 26, 4 ), 0xdca5a8138ad37c87ull );
+	EXPECT_EQ( fast_hash( "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", 62, 5 ), 0xb9e734f117cfaf70ull );
+	EXPECT_EQ( fast_hash( "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 80, 6 ), 0x6cc5eab49a92d617ull );
+}
+
+TEST( fast_hash_test_suite, distinct_for_every_length_and_prefix )
+{
+	using namespace stk;
+
+	//! Every prefix of a long key exercises each of the short, 16 byte and 48 byte paths.
+	std::string key;
+	std::set<std::uint64_t> hashes;
+	for( auto i = 0; i < 300; ++i )
+	{
+		EXPECT_TRUE( hashes.insert( fast_hash( key ) ).second );
+		EXPECT_EQ( fast_hash( key ), fast_hash( std::string( key ) ) );
+		key.push_back( static_cast<char>( 'a' + i % 26 ) );
+	}
+}
+
+TEST( string_interner_test_suite, intern_find_and_get )
+{
+	using namespace stk;
+
+	string_interner sut;
+	auto a = sut.intern( "alpha" );
+	auto b = sut.intern( std::string( "beta" ) );
+	auto e = sut.intern( "" );
+
+	EXPECT_EQ( a, 0u );
+	EXPECT_EQ( b, 1u );
+	EXPECT_EQ( e, 2u );
+	EXPECT_EQ( sut.intern( "alpha" ), a );
+	EXPECT_EQ( sut.find( "beta" ), b );
+	EXPECT_EQ( sut.find( "gamma" ), string_interner::invalid_id );
+	EXPECT_EQ( sut.get( a ), "alpha" );
+	EXPECT_STREQ( sut.c_str( b ), "beta" );
+	EXPECT_EQ( sut.get( e ), "" );
+	EXPECT_EQ( sut.size(), 3u );
+}
+
+TEST( string_interner_test_suite, views_are_stable_across_growth )
+{
+	using namespace stk;
+
+	string_interner sut( 4, 256 );
+	auto first = sut.get( sut.intern( "first" ) );
+	std::string longKey( 1000, 'x' );
+	auto longId = sut.intern( longKey );
+	for( auto i = 0; i < 10000; ++i )
+		sut.intern( "key_" + std::to_string( i ) );
+
+	EXPECT_EQ( sut.size(), 10002u );
+	EXPECT_EQ( first.data(), sut.get( 0 ).data() );
+	EXPECT_EQ( first, "first" );
+	EXPECT_EQ( sut.get( longId ), longKey );
+	for( auto i = 0; i < 10000; ++i )
+		EXPECT_EQ( sut.get( sut.find( "key_" + std::to_string( i ) ) ), "key_" + std::to_string( i ) );
+}
+
+TEST( string_interner_test_suite, bulk_intern )
+{
+	using namespace stk;
+
+	string_interner sut;
+	sut.intern( "c" );
+	std::vector<std::string> keys = { "a", "b", "c", "a", "d" };
+	std::vector<string_interner::id_type> ids;
+	sut.intern( keys.begin(), keys.end(), std::back_inserter( ids ) );
+
+	ASSERT_EQ( ids.size(), keys.size() );
+	EXPECT_EQ( ids[2], 0u );
+	EXPECT_EQ( ids[0], ids[3] );
+	EXPECT_EQ( sut.size(), 4u );
+	for( std::size_t i = 0; i < keys.size(); ++i )
+		EXPECT_EQ( sut.get( ids[i] ), keys[i] );
+}
+
+TEST( string_interner_test_suite, concurrent_intern_assigns_one_id_per_string )
+{
+	using namespace stk;
+
+	string_interner sut( 16 );
+	auto nThreads = 8;
+	auto nKeys = 20000;
+	std::vector<std::vector<string_interner::id_type>> ids( nThreads, std::vector<string_interner::id_type>( nKeys ) );
+	std::vector<std::thread> threads;
+	for( auto t = 0; t < nThreads; ++t )
+	{
+		threads.emplace_back( [&, t]()
+		{
+			//! Each thread interns the same keys in a different order while the table grows.
+			for( auto i = 0; i < nKeys; ++i )
+			{
+				auto k = ( i * 7919 + t * 104729 ) % nKeys;
+				ids[t][k] = sut.intern( "name_" + std::to_string( k ) );
+			}
+		} );
+	}
+	for( auto& t : threads )
+		t.join();
+
+	EXPECT_EQ( sut.size(), static_cast<std::size_t>( nKeys ) );
+	for( auto k = 0; k < nKeys; ++k )
+	{
+		for( auto t = 1; t < nThreads; ++t )
+			EXPECT_EQ( ids[t][k], ids[0][k] );
+		EXPECT_EQ( sut.get( ids[0][k] ), "name_" + std::to_string( k ) );
+	}
+}
@@ -0,0 +1,327 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <stk/sim/histogram_1d.hpp>
+#include <stk/sim/concurrent_histogram_1d.hpp>
+#include <stk/thread/work_stealing_thread_pool.hpp>
+#include <stk/thread/concurrentqueue.h>
+#include <stk/thread/concurrentqueue_queue_info_no_tokens.h>
+#include <geometrix/utility/scope_timer.ipp>
+#include <random>
+#include <cmath>
+#include <vector>
+
+using mc_queue_traits = moodycamel_concurrent_queue_traits_no_tokens;
+
+namespace {
+    //! A deterministic value in [0, 10) for each job index.
+    inline double job_value(std::ptrdiff_t q)
+    {
+        return std::fmod(static_cast<double>(q) * 0.6180339887498949, 1.0) * 10.0;
+    }
+}
+
+TEST(histogram_1d_test_suite, sample_uniform_histogram)
+{
+	stk::histogram_1d<double> h(10, 0.0, 10.0);
+	for (auto i = 0; i < 10; ++i)
+		h.fill(i + 0.5);
+
+	std::mt19937 gen(13);
+	auto N = 100000;
+	auto mean = 0.0;
+	for (auto i = 0; i < N; ++i)
+	{
+		auto x = h.sample(gen);
+		EXPECT_GE(x, 0.0);
+		EXPECT_LE(x, 10.0);
+		mean += x;
+	}
+
+	EXPECT_NEAR(5.0, mean / N, 0.05);
+}
+
+TEST(histogram_1d_test_suite, small_fill_batch_on_fine_histogram_matches_fill)
+{
+	//! Fewer values than bins take the direct accumulation path.
+	std::vector<double> xs = { -1.0, 0.0, 0.5, 0.5, 3.25, 9.999, 10.0, 11.0 };
+	std::vector<double> ws = { 1.0, 2.0, 0.5, 0.25, 3.0, 1.5, 4.0, 1.0 };
+	stk::histogram_1d<double> h(100000, 0.0, 10.0), b(100000, 0.0, 10.0);
+	auto inRange = std::size_t{};
+	for (std::size_t i = 0; i < xs.size(); ++i)
+	{
+		if (h.find_bin(xs[i]) == stk::histogram_1d<double>::invalid_bin)
+			continue;
+		++inRange;
+		h.fill(xs[i], ws[i]);
+	}
+
+	EXPECT_EQ(inRange, b.fill_batch(xs, ws));
+	EXPECT_EQ(h.get_counts(), b.get_counts());
+	for (std::size_t i = 0; i < h.get_number_bins(); ++i)
+		ASSERT_EQ(h.get_bin_weight(i), b.get_bin_weight(i)) << "bin " << i;
+}
+
+TEST(histogram_1d_test_suite, fill_batch_matches_fill)
+{
+	std::mt19937 gen(13);
+	std::normal_distribution<double> N(5.0, 3.0);
+	std::uniform_real_distribution<double> W(0.5, 2.0);
+	std::vector<double> xs(100000), ws(xs.size());
+	for (std::size_t i = 0; i < xs.size(); ++i)
+	{
+		xs[i] = N(gen);
+		ws[i] = W(gen);
+	}
+	xs[0] = 0.0;
+	xs[1] = 10.0;
+
+	stk::histogram_1d<double> h(200, 0.0, 10.0), hw(200, 0.0, 10.0), b(200, 0.0, 10.0), bw(200, 0.0, 10.0);
+	auto inRange = std::size_t{};
+	for (std::size_t i = 0; i < xs.size(); ++i)
+	{
+		if (h.find_bin(xs[i]) == stk::histogram_1d<double>::invalid_bin)
+			continue;
+		++inRange;
+		h.fill(xs[i]);
+		hw.fill(xs[i], ws[i]);
+	}
+
+	{
+		GEOMETRIX_MEASURE_SCOPE_TIME("histogram_1d fill_batch");
+		EXPECT_EQ(inRange, b.fill_batch(xs));
+	}
+	EXPECT_EQ(inRange, bw.fill_batch(xs, ws));
+
+	EXPECT_EQ(h.get_counts(), b.get_counts());
+	EXPECT_EQ(hw.get_counts(), bw.get_counts());
+	for (std::size_t i = 0; i < h.get_number_bins(); ++i)
+	{
+		EXPECT_EQ(h.get_bin_weight(i), b.get_bin_weight(i));
+		EXPECT_NEAR(hw.get_bin_weight(i), bw.get_bin_weight(i), 1e-9);
+	}
+}
+
+TEST(histogram_1d_test_suite, frozen_sampler_reproduces_histogram)
+{
+	stk::histogram_1d<double> h(50, -5.0, 5.0);
+	std::mt19937 gen(13);
+	std::normal_distribution<double> N;
+	for (auto i = 0; i < 100000; ++i)
+	{
+		auto x = N(gen);
+		if (h.find_bin(x) != stk::histogram_1d<double>::invalid_bin)
+			h.fill(x);
+	}
+
+	ASSERT_TRUE(h.freeze());
+	stk::histogram_1d<double> s(50, -5.0, 5.0);
+	for (auto i = 0; i < 100000; ++i)
+		s.fill(h.sample(gen));
+
+	EXPECT_GT(h.chi_squared_test(s).second, 0.001);
+}
+
+TEST(concurrent_histogram_1d_test_suite, snapshot_matches_sequential_fill)
+{
+	using namespace stk;
+	using namespace stk::thread;
+
+	work_stealing_thread_pool<mc_queue_traits> pool(4);
+	concurrent_histogram_1d<double> ch(100, 0.0, 10.0, pool.number_threads());
+
+	auto nItems = 100000L;
+	{
+		GEOMETRIX_MEASURE_SCOPE_TIME("concurrent_histogram_1d fill");
+		pool.parallel_apply(nItems, [&ch](std::ptrdiff_t q)
+		{
+			ch.fill(work_stealing_thread_pool<mc_queue_traits>::get_thread_id(), job_value(q));
+		});
+	}
+
+	histogram_1d<double> expected(100, 0.0, 10.0);
+	for (auto q = 0L; q < nItems; ++q)
+		expected.fill(job_value(q));
+
+	auto h = ch.snapshot();
+	EXPECT_EQ(expected.get_counts(), h.get_counts());
+	EXPECT_EQ(expected.integral(), h.integral());
+	for (std::size_t i = 0; i < h.get_number_bins(); ++i)
+		EXPECT_EQ(expected.get_bin_weight(i), h.get_bin_weight(i));
+
+	auto result = h.chi_squared_test(expected);
+	EXPECT_NEAR(0.0, result.first, 1e-12);
+	EXPECT_NEAR(1.0, result.second, 1e-12);
+}
+
+TEST(concurrent_histogram_1d_test_suite, out_of_range_is_ignored)
+{
+	stk::concurrent_histogram_1d<double> ch(10, 0.0, 1.0, 1);
+	EXPECT_EQ(stk::concurrent_histogram_1d<double>::invalid_bin, ch.fill(0, 2.0));
+	EXPECT_EQ(9U, ch.fill(1, 1.0));
+	auto h = ch.snapshot();
+	EXPECT_EQ(1.0, h.get_counts());
+	EXPECT_EQ(1.0, h.get_bin_weight(9));
+
+	ch.reset();
+	EXPECT_EQ(0.0, ch.snapshot().integral());
+}
+
+#include <stk/sim/histogram_nd.hpp>
+TEST(histogram_nd_test_suite, dense_and_sparse_agree)
+{
+	using histogram = stk::histogram_nd<double, 3>;
+	using axis = histogram::axis_type;
+	auto axes = std::array<axis, 3>{ axis(20, 0.0, 10.0), axis(10, -5.0, 5.0), axis(5, 0.0, 1.0) };
+	histogram dense(axes, stk::histogram_storage::dense), sparse(axes, stk::histogram_storage::sparse);
+	EXPECT_FALSE(dense.is_sparse());
+	EXPECT_TRUE(sparse.is_sparse());
+
+	std::mt19937 gen(13);
+	std::normal_distribution<double> N(0.0, 2.0);
+	std::uniform_real_distribution<double> U;
+	for (auto i = 0; i < 10000; ++i)
+	{
+		auto p = histogram::point_type{ 5.0 + N(gen), N(gen), U(gen) };
+		EXPECT_EQ(dense.fill(p), sparse.fill(p));
+	}
+
+	EXPECT_EQ(dense.get_counts(), sparse.get_counts());
+	EXPECT_EQ(dense.integral(), sparse.integral());
+	EXPECT_EQ(dense.get_number_filled_cells(), sparse.get_number_filled_cells());
+	for (std::size_t c = 0; c < dense.get_number_cells(); ++c)
+	{
+		EXPECT_EQ(dense.get_cell_weight(c), sparse.get_cell_weight(c));
+		EXPECT_EQ(c, dense.get_cell(dense.get_index(c)));
+	}
+}
+
+TEST(histogram_nd_test_suite, projection_matches_histogram_1d)
+{
+	using histogram = stk::histogram_nd<double, 2>;
+	using axis = histogram::axis_type;
+	histogram h({ axis(100, 0.0, 10.0), axis(50, 0.0, 5.0) });
+	stk::histogram_1d<double> hx(100, 0.0, 10.0), hy(50, 0.0, 5.0);
+
+	std::mt19937 gen(13);
+	std::uniform_real_distribution<double> X(0.0, 10.0), Y(0.0, 5.0);
+	for (auto i = 0; i < 10000; ++i)
+	{
+		auto x = X(gen), y = Y(gen);
+		h.fill({ x, y });
+		hx.fill(x);
+		hy.fill(y);
+	}
+
+	auto px = h.project(0), py = h.project(1);
+	for (std::size_t i = 0; i < hx.get_number_bins(); ++i)
+		EXPECT_EQ(hx.get_bin_weight(i), px.get_bin_weight(i));
+	for (std::size_t i = 0; i < hy.get_number_bins(); ++i)
+		EXPECT_EQ(hy.get_bin_weight(i), py.get_bin_weight(i));
+}
+
+TEST(histogram_nd_test_suite, large_grid_defaults_to_sparse_and_merges)
+{
+	using histogram = stk::histogram_nd<double, 2>;
+	using axis = histogram::axis_type;
+	auto axes = std::array<axis, 2>{ axis(10000, 0.0, 10000.0), axis(10000, 0.0, 10000.0) };
+	histogram a(axes), b(axes);
+	EXPECT_TRUE(a.is_sparse());
+
+	a.fill({ 1.5, 2.5 });
+	b.fill({ 1.5, 2.5 }, 2.0);
+	b.fill({ 9999.0, 10000.0 });
+	EXPECT_EQ(histogram::invalid_bin, b.fill({ -1.0, 0.0 }));
+
+	a += b;
+	EXPECT_EQ(3.0, a.get_counts());
+	EXPECT_EQ(2U, a.get_number_filled_cells());
+	EXPECT_EQ(3.0, a.get_bin_weight({ 1, 2 }));
+	EXPECT_EQ(1.0, a.get_bin_weight({ 9999, 9999 }));
+}
+
+#include <stk/sim/tdigest.hpp>
+//! The error of a quantile estimate measured as the difference between q and the empirical rank of the estimate.
+inline double rank_error(const std::vector<double>& sorted, double q, double estimate)
+{
+	auto rank = std::distance(sorted.begin(), std::lower_bound(sorted.begin(), sorted.end(), estimate));
+	return std::abs(static_cast<double>(rank) / sorted.size() - q);
+}
+
+TEST(tdigest_test_suite, quantiles_of_normal)
+{
+	stk::tdigest<> digest(200);
+	std::mt19937 gen(13);
+	std::normal_distribution<double> N;
+	std::vector<double> xs(1000000);
+	for (auto& x : xs)
+	{
+		x = N(gen);
+		digest.add(x);
+	}
+	std::sort(xs.begin(), xs.end());
+
+	EXPECT_LE(digest.get_number_centroids(), 200U);
+	for (auto q : { 0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999 })
+	{
+		//! The tails are held to a tighter absolute error than the median.
+		auto tolerance = 0.05 * std::min(q, 1.0 - q) + 1e-4;
+		EXPECT_LT(rank_error(xs, q, digest.quantile(q)), tolerance) << "q = " << q;
+		EXPECT_NEAR(q, digest.cdf(xs[static_cast<std::size_t>(q * xs.size())]), tolerance) << "q = " << q;
+	}
+}
+
+TEST(tdigest_test_suite, merged_digests_match_single_digest)
+{
+	std::mt19937 gen(13);
+	std::exponential_distribution<double> E(1.0);
+	stk::tdigest<> all;
+	std::vector<stk::tdigest<>> shards(8);
+	std::vector<double> xs(400000);
+	for (std::size_t i = 0; i < xs.size(); ++i)
+	{
+		xs[i] = E(gen);
+		all.add(xs[i]);
+		shards[i % shards.size()].add(xs[i]);
+	}
+	std::sort(xs.begin(), xs.end());
+
+	stk::tdigest<> merged;
+	for (const auto& s : shards)
+		merged.merge(s);
+
+	EXPECT_EQ(all.get_count(), merged.get_count());
+	EXPECT_EQ(all.get_min(), merged.get_min());
+	EXPECT_EQ(all.get_max(), merged.get_max());
+	for (auto q : { 0.01, 0.5, 0.9, 0.99, 0.999 })
+	{
+		//! Merging re-clusters the shard centroids so allow roughly one more centroid width of error.
+		auto tolerance = 0.05 * std::min(q, 1.0 - q) + 1e-4;
+		EXPECT_LT(rank_error(xs, q, all.quantile(q)), tolerance) << "q = " << q;
+		EXPECT_LT(rank_error(xs, q, merged.quantile(q)), 2.0 * tolerance) << "q = " << q;
+	}
+}
+
+TEST(tdigest_test_suite, self_merge_doubles_weight)
+{
+	std::mt19937 gen(13);
+	std::uniform_real_distribution<double> U(0.0, 1.0);
+	stk::tdigest<> digest;
+	for (auto i = 0; i < 10000; ++i)
+		digest.add(U(gen));
+	auto median = digest.quantile(0.5);
+
+	digest.merge(digest);
+
+	EXPECT_EQ(20000.0, digest.get_count());
+	EXPECT_NEAR(median, digest.quantile(0.5), 0.01);
+}
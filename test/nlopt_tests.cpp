@@ -0,0 +1,102 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <stk/optimization/nlopt_minimize.hpp>
+#include <stk/thread/work_stealing_thread_pool.hpp>
+#include <stk/thread/concurrentqueue.h>
+#include <stk/thread/concurrentqueue_queue_info_no_tokens.h>
+#include <stk/units/boost_units.hpp>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+using mc_queue_traits = moodycamel_concurrent_queue_traits_no_tokens;
+
+namespace {
+	inline double bowl(const std::array<double, 2>& s)
+	{
+		return (s[0] - 1.0) * (s[0] - 1.0) + (s[1] + 2.0) * (s[1] + 2.0);
+	}
+}
+
+TEST(nlopt_test_suite, minimize_reports_iterations)
+{
+	stk::nlopt_options options;
+	options.max_evaluations = 3000;
+	options.iteration_size = 100;
+	stk::nlopt_statistics stats;
+	auto s = stk::nlopt_minimize(std::array<double, 2>{ 0.0, 0.0 }, std::array<double, 2>{ -5.0, -5.0 }, std::array<double, 2>{ 5.0, 5.0 }, bowl, options, &stats);
+	EXPECT_GT(stats.status, 0);
+	EXPECT_NEAR(1.0, s[0], 0.1);
+	EXPECT_NEAR(-2.0, s[1], 0.1);
+	EXPECT_EQ(bowl(s), stats.min_cost);
+
+	std::size_t evaluations = 0;
+	for (const auto& it : stats.iterations) {
+		EXPECT_LE(it.evaluations, options.iteration_size);
+		evaluations += it.evaluations;
+	}
+	EXPECT_EQ(stats.evaluations, evaluations);
+	EXPECT_LE(stats.evaluations, options.max_evaluations);
+}
+
+TEST(nlopt_test_suite, minimize_units_typed_parameters)
+{
+	using namespace boost::units;
+	using state = std::tuple<stk::units::length, stk::units::time>;
+	auto cost = [](const state& s)
+	{
+		auto dx = std::get<0>(s) - 3.0 * si::meters;
+		auto dt = std::get<1>(s) - 0.5 * si::seconds;
+		return dx * dx / (1.0 * si::square_meters) + dt * dt / (1.0 * si::seconds * si::seconds);
+	};
+
+	stk::nlopt_options options;
+	options.max_evaluations = 3000;
+	auto s = stk::nlopt_minimize(state{ 0.0 * si::meters, 0.0 * si::seconds }, state{ -10.0 * si::meters, -1.0 * si::seconds }, state{ 10.0 * si::meters, 1.0 * si::seconds }, cost, options);
+	EXPECT_NEAR(3.0, std::get<0>(s).value(), 0.1);
+	EXPECT_NEAR(0.5, std::get<1>(s).value(), 0.05);
+}
+
+TEST(nlopt_test_suite, cost_exceptions_propagate)
+{
+	std::size_t calls = 0;
+	auto cost = [&calls](const std::vector<double>&) -> double { if (++calls == 10) throw std::runtime_error("failed"); return 1.0; };
+	EXPECT_THROW(stk::nlopt_minimize(std::vector<double>{ 0.0 }, std::vector<double>{ -1.0 }, std::vector<double>{ 1.0 }, cost), std::runtime_error);
+	EXPECT_EQ(10u, calls);
+}
+
+TEST(nlopt_test_suite, parallel_restarts_return_the_best_run)
+{
+	stk::thread::work_stealing_thread_pool<mc_queue_traits> pool;
+	std::atomic<std::size_t> calls{ 0 };
+	auto cost = [&calls](const std::array<double, 2>& s) { ++calls; return bowl(s); };
+
+	stk::nlopt_options options;
+	options.max_evaluations = 1000;
+	options.restarts = 4;
+	std::vector<stk::nlopt_statistics> stats;
+	auto s = stk::parallel_nlopt_minimize(std::array<double, 2>{ 0.0, 0.0 }, std::array<double, 2>{ -5.0, -5.0 }, std::array<double, 2>{ 5.0, 5.0 }, cost, pool, options, &stats);
+	ASSERT_EQ(4u, stats.size());
+
+	std::size_t evaluations = 0;
+	double best = std::numeric_limits<double>::infinity();
+	for (const auto& r : stats) {
+		evaluations += r.evaluations;
+		best = (std::min)(best, r.min_cost);
+	}
+	EXPECT_EQ(calls.load(), evaluations);
+	EXPECT_EQ(best, bowl(s));
+}
@@ -0,0 +1,292 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <stk/optimization/memoized_cost.hpp>
+#include <stk/optimization/parallel_spsa.hpp>
+#include <stk/optimization/parallel_tempering.hpp>
+#include <stk/optimization/random_search.hpp>
+#include <stk/thread/thread_pool_executor.hpp>
+#include <stk/thread/seq_executor.hpp>
+#include <stk/random/philox4x32_generator.hpp>
+#include <stk/thread/work_stealing_thread_pool.hpp>
+#include <stk/thread/concurrentqueue.h>
+#include <stk/thread/concurrentqueue_queue_info_no_tokens.h>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <future>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using mc_queue_traits = moodycamel_concurrent_queue_traits_no_tokens;
+
+namespace {
+	struct serial_executor
+	{
+		template <typename Fn>
+		void parallel_apply(std::ptrdiff_t count, Fn&& fn)
+		{
+			for (std::ptrdiff_t i = 0; i < count; ++i)
+				fn(i);
+		}
+	};
+
+	//! A quadratic bowl observed through noise drawn from the simulation's random number stream.
+	struct noisy_bowl
+	{
+		double operator()(const std::vector<double>& theta, std::uint64_t stream) const
+		{
+			stk::philox4x32_generator rng(17, stream);
+			std::normal_distribution<double> noise(0.0, 0.5);
+			auto sum = noise(rng);
+			for (std::size_t i = 0; i < theta.size(); ++i)
+				sum += (theta[i] - 0.1 * i) * (theta[i] - 0.1 * i);
+			return sum;
+		}
+	};
+
+	inline double distance_to_optimum(const std::vector<double>& theta)
+	{
+		auto d = 0.0;
+		for (std::size_t i = 0; i < theta.size(); ++i)
+			d += (theta[i] - 0.1 * i) * (theta[i] - 0.1 * i);
+		return std::sqrt(d);
+	}
+}
+
+TEST(parallel_spsa_test_suite, common_random_numbers_converge_on_noisy_cost)
+{
+	stk::thread::work_stealing_thread_pool<mc_queue_traits> pool;
+	std::vector<double> theta0(8, 1.0);
+
+	stk::spsa_options options;
+	options.samples = 4;
+	auto crn = stk::parallel_spsa(theta0, 400, noisy_bowl(), pool, options);
+	EXPECT_LT(distance_to_optimum(crn), 0.05);
+
+	//! Independent streams leave the noise in the gradient estimate.
+	options.common_random_numbers = false;
+	auto independent = stk::parallel_spsa(theta0, 400, noisy_bowl(), pool, options);
+	EXPECT_LT(distance_to_optimum(crn), distance_to_optimum(independent));
+}
+
+TEST(parallel_spsa_test_suite, result_does_not_depend_on_executor)
+{
+	stk::thread::work_stealing_thread_pool<mc_queue_traits> pool;
+	serial_executor serial;
+	std::vector<double> theta0(5, -1.0);
+
+	stk::spsa_options options;
+	options.samples = 3;
+	auto a = stk::parallel_spsa(theta0, 50, noisy_bowl(), pool, options);
+	auto b = stk::parallel_spsa(theta0, 50, noisy_bowl(), serial, options);
+	EXPECT_EQ(a, b);
+
+	//! Costs without a stream argument are supported too.
+	auto c = stk::parallel_spsa(theta0, 50, [](const std::vector<double>& t) { return t[0] * t[0]; }, pool, options);
+	EXPECT_EQ(5, c.size());
+}
+
+namespace {
+	//! Rastrigin's function has a regular lattice of local minima around the global minimum at the origin.
+	inline double rastrigin(const std::array<double, 2>& s)
+	{
+		auto pi = 3.14159265358979323846;
+		return 20.0 + s[0] * s[0] - 10.0 * std::cos(2.0 * pi * s[0]) + s[1] * s[1] - 10.0 * std::cos(2.0 * pi * s[1]);
+	}
+
+	struct gaussian_step
+	{
+		template <typename Engine>
+		std::array<double, 2> operator()(const std::array<double, 2>& s, Engine& rng) const
+		{
+			std::normal_distribution<double> step(0.0, 0.25);
+			return { s[0] + step(rng), s[1] + step(rng) };
+		}
+	};
+}
+
+TEST(parallel_tempering_test_suite, finds_global_minimum_of_rastrigin)
+{
+	stk::thread::work_stealing_thread_pool<mc_queue_traits> pool;
+	auto temp = [](std::size_t k) { return 0.05 + 0.5 * static_cast<double>(k) / 20000.0; };
+	std::array<double, 2> s0 = { 4.5, -3.5 };
+
+	stk::parallel_tempering_options options;
+	options.chains = 6;
+	double minCost = 0;
+	auto best = stk::parallel_tempering(s0, 20000, rastrigin, temp, gaussian_step(), pool, options, &minCost);
+	EXPECT_NEAR(0.0, best[0], 0.05);
+	EXPECT_NEAR(0.0, best[1], 0.05);
+	EXPECT_EQ(rastrigin(best), minCost);
+
+	//! The chains draw from their own streams so the schedule does not change the result.
+	serial_executor serial;
+	auto serialBest = stk::parallel_tempering(s0, 20000, rastrigin, temp, gaussian_step(), serial, options);
+	EXPECT_EQ(best, serialBest);
+}
+
+TEST(random_search_test_suite, batched_search_matches_across_executors)
+{
+	using pool_t = stk::thread::work_stealing_thread_pool<mc_queue_traits>;
+	pool_t pool;
+	stk::thread_pool_executor<pool_t> parallel(pool);
+	stk::seq_executor serial;
+
+	auto cost = [](const std::array<double, 2>& s) { return (s[0] - 1.0) * (s[0] - 1.0) + (s[1] + 2.0) * (s[1] + 2.0); };
+	auto run = [&](auto& executor)
+	{
+		std::mt19937 gen(3);
+		auto neighbor = [&gen](const std::array<double, 2>& s)
+		{
+			std::normal_distribution<double> step(0.0, 0.1);
+			return std::array<double, 2>{ s[0] + step(gen), s[1] + step(gen) };
+		};
+		stk::random_search_options options;
+		options.batch_size = 16;
+		return stk::random_search(std::array<double, 2>{ 0.0, 0.0 }, 500, cost, neighbor, executor, options);
+	};
+
+	auto a = run(parallel);
+	auto b = run(serial);
+	EXPECT_EQ(a, b);
+	EXPECT_NEAR(1.0, a[0], 0.05);
+	EXPECT_NEAR(-2.0, a[1], 0.05);
+}
+
+TEST(random_search_test_suite, batched_search_stops_early)
+{
+	stk::seq_executor serial;
+	std::size_t calls = 0;
+	auto neighbor = [&calls](double s) { ++calls; return s + 1.0; };
+
+	//! A flat cost never improves so the search stalls.
+	stk::random_search_options options;
+	options.batch_size = 4;
+	options.max_stall_rounds = 3;
+	stk::random_search(0.0, 100, [](double) { return 1.0; }, neighbor, serial, options);
+	EXPECT_EQ(12, calls);
+
+	//! Stop at the target cost.
+	calls = 0;
+	options = stk::random_search_options();
+	options.batch_size = 1;
+	options.target_cost = -5.0;
+	double minCost = 0;
+	auto s = stk::random_search(0.0, 100, [](double x) { return -x; }, neighbor, serial, options, &minCost);
+	EXPECT_EQ(5.0, s);
+	EXPECT_EQ(-5.0, minCost);
+
+	//! An empty time budget allows a single round.
+	calls = 0;
+	options = stk::random_search_options();
+	options.time_budget = std::chrono::steady_clock::duration::zero();
+	stk::random_search(0.0, 100, [](double x) { return -x; }, neighbor, serial, options);
+	EXPECT_EQ(options.batch_size, calls);
+}
+
+TEST(memoized_cost_test_suite, quantized_states_share_an_entry)
+{
+	std::size_t calls = 0;
+	auto cost = stk::make_memoized_cost<std::array<double, 2>>([&calls](const std::array<double, 2>& s) { ++calls; return s[0] + s[1]; }, 0.01, 16);
+	EXPECT_EQ(3.0, (*cost)({ 1.0, 2.0 }));
+	EXPECT_EQ(3.0, (*cost)({ 1.001, 2.002 }));
+	EXPECT_EQ(1u, calls);
+	EXPECT_EQ(3.5, (*cost)({ 1.5, 2.0 }));
+	EXPECT_EQ(2u, calls);
+
+	auto stats = cost->get_statistics();
+	EXPECT_EQ(1u, stats.hits);
+	EXPECT_EQ(2u, stats.misses);
+	EXPECT_EQ(0u, stats.waits);
+}
+
+TEST(memoized_cost_test_suite, evicts_least_recently_used)
+{
+	std::size_t calls = 0;
+	auto cost = stk::make_memoized_cost<double>([&calls](double x) { ++calls; return x * x; }, 0.0, 2);
+	(*cost)(1.0);
+	(*cost)(2.0);
+	(*cost)(1.0);//! 2 is now the least recently used.
+	(*cost)(3.0);
+	EXPECT_EQ(2u, cost->size());
+	EXPECT_EQ(1u, cost->get_statistics().evictions);
+
+	calls = 0;
+	(*cost)(1.0);
+	EXPECT_EQ(0u, calls);
+	(*cost)(2.0);
+	EXPECT_EQ(1u, calls);
+}
+
+TEST(memoized_cost_test_suite, exceptions_are_not_cached)
+{
+	std::size_t calls = 0;
+	auto cost = stk::make_memoized_cost<double>([&calls](double x) -> double { if (++calls == 1) throw std::runtime_error("failed"); return x; }, 0.0, 4);
+	EXPECT_THROW((*cost)(1.0), std::runtime_error);
+	EXPECT_EQ(0u, cost->size());
+	EXPECT_EQ(1.0, (*cost)(1.0));
+	EXPECT_EQ(2u, calls);
+}
+
+TEST(memoized_cost_test_suite, failed_evicted_request_keeps_newer_result)
+{
+	//! The first evaluation of 1 is evicted while in flight, 1 is evaluated again and then the first evaluation fails.
+	std::promise<void> started, release;
+	auto gate = release.get_future().share();
+	std::atomic<std::size_t> calls{ 0 };
+	auto cost = stk::make_memoized_cost<double>([&](double x) -> double
+	{
+		if (++calls == 1) {
+			started.set_value();
+			gate.wait();
+			throw std::runtime_error("failed");
+		}
+		return x;
+	}, 0.0, 1);
+
+	std::thread failing([&] { EXPECT_THROW((*cost)(1.0), std::runtime_error); });
+	started.get_future().wait();
+	EXPECT_EQ(2.0, (*cost)(2.0));
+	EXPECT_EQ(1.0, (*cost)(1.0));
+	release.set_value();
+	failing.join();
+
+	EXPECT_EQ(1u, cost->size());
+	EXPECT_EQ(1.0, (*cost)(1.0));
+	EXPECT_EQ(3u, calls.load());
+	EXPECT_EQ(1u, cost->get_statistics().hits);
+}
+
+TEST(memoized_cost_test_suite, concurrent_requests_evaluate_once)
+{
+	stk::thread::work_stealing_thread_pool<mc_queue_traits> pool;
+	std::atomic<std::size_t> calls{ 0 };
+	auto cost = stk::make_memoized_cost<double>([&calls](double x)
+	{
+		++calls;
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		return 2.0 * x;
+	}, 0.0, 8);
+
+	std::vector<double> results(64);
+	pool.parallel_apply(static_cast<std::ptrdiff_t>(results.size()), [&](std::ptrdiff_t i) { results[i] = (*cost)(static_cast<double>(i % 4)); });
+	for (std::size_t i = 0; i < results.size(); ++i)
+		EXPECT_EQ(2.0 * (i % 4), results[i]);
+	EXPECT_EQ(4u, calls.load());
+
+	auto stats = cost->get_statistics();
+	EXPECT_EQ(4u, stats.misses);
+	EXPECT_EQ(60u, stats.hits + stats.waits);
+}
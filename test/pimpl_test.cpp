@@ -1,5 +1,6 @@
 #include "pimpl_test.hpp"
 #include <stk/utility/pimpl.hpp>
+#include <stk/utility/pimpl.ipp>
 #include <geometrix/utility/assert.hpp>
 
 struct A::AImpl
@@ -148,3 +149,36 @@ int A_no_copy::get_x() const
 {
 	return m_impl->x;
 }
+
+struct F::FImpl
+{
+	FImpl(int x = 0)
+		: x{ x }
+	{}
+
+	int x;
+};
+
+F::F() = default;
+
+F::F(int x)
+	: m_impl(std::in_place, x)
+{
+
+}
+
+F::F(const F& o) = default;
+F::F(F&& o) = default;
+F& F::operator=(const F& o) = default;
+F& F::operator=(F&& o) = default;
+F::~F() = default;
+
+int F::get_x() const
+{
+	return m_impl->x;
+}
+
+void F::set_x(int x)
+{
+	m_impl->x = x;
+}
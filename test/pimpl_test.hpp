@@ -110,4 +110,26 @@ struct B
 	struct BImpl;
 	stk::pimpl<BImpl> m_impl;
 
+};
+
+//! Holds its implementation in place.
+class F
+{
+public:
+
+	F();
+	F(int x);
+	F(const F& o);
+	F(F&& o);
+	F& operator =(const F& o);
+	F& operator =(F&& o);
+	~F();
+
+	int get_x() const;
+	void set_x(int x);
+
+private:
+
+	struct FImpl;
+	stk::fast_pimpl<FImpl, sizeof(int), alignof(int)> m_impl;
 };
\ No newline at end of file
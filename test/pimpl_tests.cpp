@@ -93,3 +93,39 @@ TEST(pimpl_test_suite, lamdba_deleter)
 
 	EXPECT_TRUE(deleted);
 }
+
+TEST(fast_pimpl_test_suite, storage_is_in_place)
+{
+	static_assert(sizeof(F) == sizeof(int), "The implementation should be held in F.");
+	F a;
+	EXPECT_EQ(0, a.get_x());
+}
+
+TEST(fast_pimpl_test_suite, unary_construct)
+{
+	F a(10);
+	EXPECT_EQ(10, a.get_x());
+}
+
+TEST(fast_pimpl_test_suite, copies_are_independent)
+{
+	F a(10);
+	F b = a;
+	b.set_x(20);
+	EXPECT_EQ(10, a.get_x());
+	EXPECT_EQ(20, b.get_x());
+
+	a = b;
+	EXPECT_EQ(20, a.get_x());
+}
+
+TEST(fast_pimpl_test_suite, move)
+{
+	F a(10);
+	F b = std::move(a);
+	EXPECT_EQ(10, b.get_x());
+
+	F c;
+	c = std::move(b);
+	EXPECT_EQ(10, c.get_x());
+}
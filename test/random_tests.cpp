@@ -11,6 +11,9 @@
 #include <boost/math/distributions/normal.hpp>
 #include <random>
 #include <cmath>
+#include <chrono>
+#include <algorithm>
+#include <map>
 
 #define STK_EXPORT_HISTS 0
 
@@ -280,6 +283,95 @@ INSTANTIATE_TEST_CASE_P(time_chopin, time_chopin_fixture, ::testing::Values(
   , std::make_pair(-100.0, -3.49)
 ));
 
+//! Exact cdf of the normal(m, s) truncated to [l, h]. Use the complements in the right tail to preserve precision.
+inline double truncated_normal_cdf(double x, double l, double h, double m = 0.0, double s = 1.0)
+{
+	boost::math::normal_distribution<> N(m, s);
+	if (l > m)
+	{
+		auto ql = boost::math::cdf(boost::math::complement(N, l));
+		auto qh = boost::math::cdf(boost::math::complement(N, h));
+		return (ql - boost::math::cdf(boost::math::complement(N, x))) / (ql - qh);
+	}
+
+	auto pl = boost::math::cdf(N, l);
+	auto ph = boost::math::cdf(N, h);
+	return (boost::math::cdf(N, x) - pl) / (ph - pl);
+}
+
+struct truncated_normal_ks_fixture : ::testing::TestWithParam<std::pair<double, double>>{};
+TEST_P(truncated_normal_ks_fixture, sampler_matches_exact_cdf)
+{
+	double l, h;
+	std::tie(l, h) = GetParam();
+	stk::truncated_normal_distribution<> cdist(l, h);
+	std::size_t n = 200000ULL;
+	std::vector<double> data(n);
+	std::mt19937 gen(42UL);
+	for (auto& v : data)
+	{
+		v = cdist(gen);
+		ASSERT_TRUE(v >= l && v <= h);
+	}
+
+	std::sort(data.begin(), data.end());
+	auto d = 0.0;
+	for (auto i = 0ULL; i < n; ++i)
+	{
+		auto F = truncated_normal_cdf(data[i], l, h);
+		d = (std::max)(d, (std::max)(std::abs(F - static_cast<double>(i) / n), std::abs(F - static_cast<double>(i + 1) / n)));
+	}
+
+	//! Kolmogorov critical value at alpha = 0.01.
+	auto dcrit = 1.628 / std::sqrt(static_cast<double>(n));
+	GTEST_MESSAGE("Test: ") << l << "_" << h << " method: " << static_cast<int>(cdist.param().sampler().get_method()) << " D: " << d << " Dcrit: " << dcrit;
+	EXPECT_LT(d, dcrit);
+}
+
+INSTANTIATE_TEST_CASE_P(validate_truncated_normal_sampler, truncated_normal_ks_fixture, ::testing::Values(
+    std::make_pair(-4., 4.)
+  , std::make_pair(-3., 2.)
+  , std::make_pair(-3.0, -2.0)
+  , std::make_pair(2.0, 3.0)
+  , std::make_pair(-0.48, 0.1)
+  , std::make_pair(-0.1, 0.48)
+  , std::make_pair(3.49, 100.0)
+  , std::make_pair(-100.0, -3.49)
+  , std::make_pair(5.0, 5.1)
+  , std::make_pair(7.0, 8.0)
+  , std::make_pair(20.0, std::numeric_limits<double>::infinity())
+  , std::make_pair(-std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity())
+));
+
+TEST(truncated_normal_test_suite, throughput_vs_inverse_cdf)
+{
+	std::size_t n = 1000000ULL;
+	for (auto r : { std::make_pair(-3., 2.), std::make_pair(-0.48, 0.1), std::make_pair(2.0, 3.0), std::make_pair(3.49, 100.0) })
+	{
+		auto l = r.first;
+		auto h = r.second;
+		auto sum = 0.0;
+		std::mt19937 gen(42UL);
+
+		stk::truncated_normal_distribution<> cdist(l, h);
+		auto start = std::chrono::high_resolution_clock::now();
+		for (auto i = 0ULL; i < n; ++i)
+			sum += cdist(gen);
+		auto stop = std::chrono::high_resolution_clock::now();
+		auto sampler = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+
+		boost::math::normal_distribution<> N;
+		boost::random::uniform_real_distribution<> U(boost::math::cdf(N, l), boost::math::cdf(N, h));
+		start = std::chrono::high_resolution_clock::now();
+		for (auto i = 0ULL; i < n; ++i)
+			sum += boost::math::quantile(N, U(gen));
+		stop = std::chrono::high_resolution_clock::now();
+		auto inverse = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
+
+		std::cout << "truncated_normal [" << l << ", " << h << "] sampler: " << sampler.count() << " us inverse cdf: " << inverse.count() << " us (" << sum << ")" << std::endl;
+	}
+}
+
 TEST(truncated_normal_test_suite, DISABLED_brute_normal_distribution)
 {
 	stk::histogram_1d<double> hist(1000, -9.1, -1.8);
@@ -391,6 +483,75 @@ TEST(truncated_poisson_test_suite, output_truncated_poisson)
 	EXPECT_TRUE(true);
 }
 
+#include <boost/math/distributions/poisson.hpp>
+#include <boost/math/distributions/chi_squared.hpp>
+struct truncated_poisson_fixture : ::testing::TestWithParam<double>{};
+TEST_P(truncated_poisson_fixture, matches_exact_pmf)
+{
+	auto mean = GetParam();
+	stk::zero_truncated_poisson_distribution<> dist(mean);
+	std::size_t n = 1000000ULL;
+	std::vector<int> data(n);
+	std::mt19937 gen(42UL);
+	dist.generate(gen, stk::span<int>(data));
+
+	std::map<int, std::size_t> counts;
+	for (auto v : data)
+	{
+		ASSERT_GE(v, 1);
+		++counts[v];
+	}
+
+	//! Pool the bins with small expected counts into a remainder bin.
+	boost::math::poisson_distribution<> P(mean);
+	auto p0 = boost::math::pdf(P, 0);
+	auto chi2 = 0.0;
+	auto nbins = 0;
+	auto expectedRest = static_cast<double>(n);
+	auto observedRest = static_cast<double>(n);
+	for (const auto& item : counts)
+	{
+		auto expected = n * boost::math::pdf(P, item.first) / (1.0 - p0);
+		if (expected < 20.0)
+			continue;
+		auto d = item.second - expected;
+		chi2 += d * d / expected;
+		expectedRest -= expected;
+		observedRest -= item.second;
+		++nbins;
+	}
+
+	if (expectedRest > 20.0)
+	{
+		auto d = observedRest - expectedRest;
+		chi2 += d * d / expectedRest;
+		++nbins;
+	}
+
+	ASSERT_GT(nbins, 1);
+	boost::math::chi_squared_distribution<> ch2dist(nbins - 1.0);
+	auto p = 1.0 - boost::math::cdf(ch2dist, chi2);
+	GTEST_MESSAGE("Test: ") << mean << " inversion: " << dist.param().use_inversion() << " Chi2: " << chi2 << " P-value: " << p;
+	EXPECT_GT(p, 0.01);
+}
+
+INSTANTIATE_TEST_CASE_P(validate_truncated_poisson, truncated_poisson_fixture, ::testing::Values(0.01, 0.83, 3.0, 9.99, 10.0, 37.5, 1000.0));
+
+TEST(truncated_poisson_test_suite, batch_matches_scalar)
+{
+	for (auto mean : { 0.83, 50.0 })
+	{
+		stk::zero_truncated_poisson_distribution<> dist(mean);
+		std::vector<int> batch(1000);
+		std::mt19937 gen0(42UL);
+		dist.generate(gen0, stk::span<int>(batch));
+
+		std::mt19937 gen1(42UL);
+		for (auto v : batch)
+			EXPECT_EQ(v, dist(gen1));
+	}
+}
+
 #include <stk/random/xoroshiro128plus_generator.hpp>
 TEST(xoroshiro128plus_generator_test_suite, construct)
 {
@@ -434,6 +595,209 @@ TEST(xorshift1024starphi_test_suite, construct)
 	EXPECT_GT(p, 0.05);
 }
 
+TEST(xoroshiro128plus_generator_test_suite, jump_partitions_streams)
+{
+	auto a = stk::xoroshiro128plus_generator{};
+	auto b = stk::xoroshiro128plus_generator{};
+	b.jump();
+	auto c = stk::xoroshiro128plus_generator{};
+	c.jump();
+	EXPECT_NE(a(), b());
+	EXPECT_EQ(b(), (c(), c()));
+
+	auto d = stk::xoroshiro128plus_generator{};
+	d.long_jump();
+	auto e = stk::xoroshiro128plus_generator{};
+	e.jump();
+	EXPECT_NE(d(), e());
+}
+
+#include <stk/random/xorshift128plus_generator.hpp>
+TEST(xorshift128plus_generator_test_suite, jump_partitions_streams)
+{
+	auto a = stk::xorshift128plus_generator{};
+	auto b = stk::xorshift128plus_generator{};
+	b.jump();
+	auto c = stk::xorshift128plus_generator{};
+	c.jump();
+	EXPECT_NE(a(), b());
+	EXPECT_EQ(b(), (c(), c()));
+	c.long_jump();
+	EXPECT_NE(b(), c());
+}
+
+TEST(xorshift1024starphi_test_suite, jump_partitions_streams)
+{
+	auto a = stk::xorshift1024starphi_generator{};
+	auto b = stk::xorshift1024starphi_generator{};
+	a();
+	b();
+	b.jump();
+	auto c = stk::xorshift1024starphi_generator{};
+	c();
+	c.jump();
+	EXPECT_NE(a(), b());
+	EXPECT_EQ(b(), (c(), c()));
+	c.long_jump();
+	EXPECT_NE(b(), c());
+}
+
+#include <stk/random/sobol_sequence.hpp>
+#include <stk/random/halton_sequence.hpp>
+#include <stk/random/r2_sequence.hpp>
+template <typename Sequence>
+inline bool is_stratified(Sequence seq, std::size_t n)
+{
+	std::vector<std::array<double, Sequence::dimension()>> points(n);
+	for (auto& p : points)
+		p = seq();
+
+	for (std::size_t d = 0; d < Sequence::dimension(); ++d)
+	{
+		std::vector<int> counts(n, 0);
+		for (const auto& p : points)
+			++counts[static_cast<std::size_t>(p[d] * n)];
+		if (std::any_of(counts.begin(), counts.end(), [](int c) { return c != 1; }))
+			return false;
+	}
+
+	return true;
+}
+
+TEST(low_discrepancy_sequence_test_suite, sobol_one_dimensional_projections_are_stratified)
+{
+	EXPECT_TRUE(is_stratified(stk::sobol_sequence<21>(), 4096));
+	EXPECT_TRUE(is_stratified(stk::sobol_sequence<21>(1234), 4096));
+}
+
+TEST(low_discrepancy_sequence_test_suite, sobol_first_points)
+{
+	stk::sobol_sequence<2> seq;
+	auto expected = std::vector<std::array<double, 2>>{ { 0.0, 0.0 }, { 0.5, 0.5 }, { 0.75, 0.25 }, { 0.25, 0.75 }, { 0.375, 0.375 } };
+	for (const auto& p : expected)
+		EXPECT_EQ(p, seq());
+}
+
+TEST(low_discrepancy_sequence_test_suite, halton_first_points)
+{
+	stk::halton_sequence<2> seq;
+	auto p = seq();
+	EXPECT_DOUBLE_EQ(0.5, p[0]);
+	EXPECT_DOUBLE_EQ(1.0 / 3.0, p[1]);
+	p = stk::halton_sequence<2>::get(5);
+	EXPECT_DOUBLE_EQ(0.625, p[0]);
+	EXPECT_DOUBLE_EQ(7.0 / 9.0, p[1]);
+}
+
+template <typename Sequence>
+inline void check_partitioned_matches_sequential(Sequence seq)
+{
+	const std::size_t n = 1000, workers = 4, chunk = n / workers;
+	const auto start = seq.position();
+	std::vector<typename Sequence::result_type> sequential(n);
+	for (auto& p : sequential)
+		p = seq();
+
+	for (std::size_t w = 0; w < workers; ++w)
+	{
+		auto worker = seq;
+		worker.seek(start + w * chunk);
+		for (std::size_t i = 0; i < chunk; ++i)
+			EXPECT_EQ(sequential[w * chunk + i], worker());
+	}
+}
+
+TEST(low_discrepancy_sequence_test_suite, skip_ahead_partitions)
+{
+	check_partitioned_matches_sequential(stk::sobol_sequence<5>(7));
+	check_partitioned_matches_sequential(stk::halton_sequence<5>());
+	check_partitioned_matches_sequential(stk::r2_sequence<5>());
+}
+
+template <typename Generator>
+inline double integrate_unit_product(Generator&& gen, std::size_t n)
+{
+	//! The integral of prod(2 x_i) over the unit cube is 1.
+	auto sum = 0.0;
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		auto p = gen();
+		auto f = 1.0;
+		for (auto x : p)
+			f *= 2.0 * x;
+		sum += f;
+	}
+
+	return std::abs(sum / n - 1.0);
+}
+
+TEST(low_discrepancy_sequence_test_suite, quasi_monte_carlo_beats_monte_carlo)
+{
+	const std::size_t n = 16384;
+	std::mt19937 gen(13);
+	boost::random::uniform_real_distribution<> U;
+	auto mcError = 0.0;
+	const auto replicates = 8;
+	for (auto r = 0; r < replicates; ++r)
+		mcError += integrate_unit_product([&]() { return std::array<double, 3>{ U(gen), U(gen), U(gen) }; }, n);
+	mcError /= replicates;
+
+	auto sobolError = integrate_unit_product(stk::sobol_sequence<3>(5), n);
+	auto haltonError = integrate_unit_product(stk::halton_sequence<3>(), n);
+	EXPECT_LT(sobolError, mcError);
+	EXPECT_LT(haltonError, mcError);
+}
+
+#include <stk/random/philox4x32_generator.hpp>
+TEST(philox4x32_generator_test_suite, known_answers)
+{
+	using counter_type = stk::philox4x32_generator::counter_type;
+	using key_type = stk::philox4x32_generator::key_type;
+
+	//! Random123 kat_vectors for philox4x32 with 10 rounds.
+	EXPECT_EQ((counter_type{ 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 }), stk::philox4x32_generator::apply(counter_type{ 0, 0, 0, 0 }, key_type{ 0, 0 }));
+	EXPECT_EQ((counter_type{ 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd }), stk::philox4x32_generator::apply(counter_type{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff }, key_type{ 0xffffffff, 0xffffffff }));
+	EXPECT_EQ((counter_type{ 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 }), stk::philox4x32_generator::apply(counter_type{ 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 }, key_type{ 0xa4093822, 0x299f31d0 }));
+}
+
+TEST(philox4x32_generator_test_suite, regenerate_agent_stream)
+{
+	auto seed = 42ULL;
+	auto agent = 123456789ULL;
+	auto tick = 17U;
+
+	auto gen = stk::philox4x32_generator{ seed, agent, tick };
+	std::vector<std::uint64_t> values(101);
+	for (auto& v : values)
+		v = gen();
+
+	for (auto i = 0ULL; i < values.size(); ++i)
+		EXPECT_EQ(values[i], stk::philox4x32_generator::generate(seed, agent, tick, i));
+
+	auto skip = stk::philox4x32_generator{ seed, agent, tick };
+	skip.discard(51);
+	EXPECT_EQ(51ULL, skip.position());
+	EXPECT_EQ(values[51], skip());
+
+	auto other = stk::philox4x32_generator{ seed, agent, tick + 1 };
+	EXPECT_NE(values[0], other());
+	other.set_stream(agent + 1, tick);
+	EXPECT_NE(values[0], other());
+}
+
+TEST(philox4x32_generator_test_suite, sample_truncated_normal)
+{
+	auto l = -2.0;
+	auto h = 3.0;
+	stk::truncated_normal_distribution<> dist(l, h);
+	auto gen = stk::philox4x32_generator{};
+	for (auto i = 0; i < 100000; ++i)
+	{
+		auto v = dist(gen);
+		EXPECT_TRUE(v >= l && v <= h);
+	}
+}
+
 TEST(linear_distribution_test_suite, verify_range)
 {
 	auto l = 5.0, h = 10.0;
@@ -546,6 +910,87 @@ double URand( int* iy )
 	return ( ( ( zi >> 7 | 1 ) + 1 ) / 16777216.0 );
 }
 
+TEST(random_batch_test_suite, linear_batch_matches_scalar)
+{
+	stk::linear_distribution<> dist(5.0, 10.0, 0.0, 33.0);
+	std::vector<double> batch(1000);
+	std::mt19937 g0(7), g1(7);
+	dist.generate(g0, stk::span<double>(batch));
+	for (auto x : batch)
+		EXPECT_EQ(dist(g1), x);
+}
+
+TEST(random_batch_test_suite, maxwell_boltzmann_batch_is_positive)
+{
+	stk::maxwell_boltzmann_distribution<> dist(2.0);
+	std::vector<double> batch(10000);
+	std::mt19937 gen(7);
+	dist.generate(gen, stk::span<double>(batch));
+	auto mean = 0.0;
+	for (auto x : batch)
+	{
+		EXPECT_GT(x, 0.0);
+		mean += x;
+	}
+	mean /= batch.size();
+	//! E[X] = 2a sqrt(2/pi).
+	EXPECT_NEAR(2.0 * 2.0 * std::sqrt(2.0 / geometrix::constants::pi<double>()), mean, 0.05);
+}
+
+TEST(random_batch_test_suite, truncated_normal_batch_within_bounds)
+{
+	std::mt19937 gen(7);
+	std::vector<double> batch(10000);
+	for (auto bounds : { std::make_pair(-3.0, 2.0), std::make_pair(4.0, 6.0), std::make_pair(-6.0, -4.5) })
+	{
+		stk::truncated_normal_distribution<> dist(bounds.first, bounds.second, 1.0, 2.0);
+		dist.generate(gen, stk::span<double>(batch));
+		for (auto x : batch)
+		{
+			EXPECT_GE(x, bounds.first);
+			EXPECT_LE(x, bounds.second);
+		}
+	}
+}
+
+TEST(random_batch_test_suite, poisson_batch_is_positive)
+{
+	stk::zero_truncated_poisson_distribution<> dist(3.0);
+	std::vector<int> batch(10000);
+	std::mt19937 gen(7);
+	dist.generate(gen, stk::span<int>(batch));
+	for (auto k : batch)
+		EXPECT_GE(k, 1);
+}
+
+template <typename Distribution>
+inline void time_scalar_vs_batch(const char* name, Distribution dist)
+{
+	using result_type = typename Distribution::result_type;
+	const std::size_t N = 1000000;
+	std::vector<result_type> results(N);
+	std::mt19937 gen(13);
+
+	auto start = std::chrono::high_resolution_clock::now();
+	for (auto& r : results)
+		r = dist(gen);
+	auto scalar = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start);
+
+	start = std::chrono::high_resolution_clock::now();
+	dist.generate(gen, stk::span<result_type>(results));
+	auto batch = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start);
+
+	std::cout << name << " scalar: " << scalar.count() << " us batch: " << batch.count() << " us" << std::endl;
+}
+
+TEST(random_batch_test_suite, time_scalar_vs_batch)
+{
+	time_scalar_vs_batch("linear", stk::linear_distribution<>(5.0, 10.0, 0.0, 33.0));
+	time_scalar_vs_batch("maxwell_boltzmann", stk::maxwell_boltzmann_distribution<>(2.0));
+	time_scalar_vs_batch("truncated_normal", stk::truncated_normal_distribution<>(-3.0, 2.0, 1.0, 2.0));
+	time_scalar_vs_batch("zero_truncated_poisson", stk::zero_truncated_poisson_distribution<>(3.0));
+}
+
 #include <random>
 #include <chrono>
 
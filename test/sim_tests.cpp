@@ -0,0 +1,256 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <stk/sim/linear_data_interpolator.hpp>
+#include <stk/units/boost_units.hpp>
+#include <stk/math/dual.hpp>
+#include <stk/optimization/gradient_descent.hpp>
+#include <stk/sim/binary_logit_model.hpp>
+#include <stk/sim/multinomial_logit_model.hpp>
+#include <stk/math/exp_batch.hpp>
+#include <geometrix/utility/scope_timer.ipp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+    //! The reference implementation: binary search and slope computed per call.
+    inline double reference_interpolate(const std::vector<double>& xs, const std::vector<double>& ys, double x)
+    {
+        auto it = std::upper_bound(xs.begin(), xs.end(), x);
+        std::size_t i = it > xs.begin() ? std::min<std::size_t>(std::distance(xs.begin(), it) - 1, xs.size() - 2) : 0;
+        return ys[i] + (ys[i + 1] - ys[i]) / (xs[i + 1] - xs[i]) * (x - xs[i]);
+    }
+}
+
+TEST(linear_data_interpolator_test_suite, uniform_and_non_uniform_match_reference)
+{
+	std::vector<double> uniformX, nonUniformX, ys;
+	for (auto i = 0; i < 101; ++i)
+	{
+		uniformX.push_back(0.5 * i);
+		nonUniformX.push_back(0.005 * i * i);
+		ys.push_back(std::sin(0.1 * i));
+	}
+
+	stk::linear_data_interpolator<double, double> uniform(uniformX, ys), nonUniform(nonUniformX, ys);
+	EXPECT_TRUE(uniform.is_uniform());
+	EXPECT_FALSE(nonUniform.is_uniform());
+
+	std::mt19937 gen(13);
+	std::uniform_real_distribution<double> U(-10.0, 60.0);
+	std::size_t hint = 0;
+	for (auto i = 0; i < 10000; ++i)
+	{
+		auto x = U(gen);
+		EXPECT_NEAR(reference_interpolate(uniformX, ys, x), uniform(x), 1e-12);
+		EXPECT_NEAR(reference_interpolate(nonUniformX, ys, x), nonUniform(x), 1e-12);
+		EXPECT_NEAR(reference_interpolate(nonUniformX, ys, x), nonUniform(x, hint), 1e-12);
+	}
+
+	//! Knots interpolate exactly.
+	for (std::size_t i = 0; i < ys.size(); ++i)
+		EXPECT_DOUBLE_EQ(ys[i], nonUniform(nonUniformX[i]));
+}
+
+TEST(linear_data_interpolator_test_suite, sorted_batch_matches_scalar)
+{
+	std::vector<double> xs, ys;
+	for (auto i = 0; i < 50; ++i)
+	{
+		xs.push_back(std::pow(1.1, i));
+		ys.push_back(std::log(xs.back()));
+	}
+
+	stk::linear_data_interpolator<double, double> f(xs, ys);
+	std::mt19937 gen(13);
+	std::uniform_real_distribution<double> U(0.0, 150.0);
+	std::vector<double> queries(100000), results(queries.size());
+	for (auto& q : queries)
+		q = U(gen);
+	std::sort(queries.begin(), queries.end());
+
+	{
+		GEOMETRIX_MEASURE_SCOPE_TIME("linear_data_interpolator evaluate_batch");
+		f.evaluate_batch(queries, results);
+	}
+
+	for (std::size_t i = 0; i < queries.size(); ++i)
+		EXPECT_EQ(f(queries[i]), results[i]);
+}
+
+TEST(linear_data_interpolator_test_suite, interpolate_with_units)
+{
+	using namespace boost::units;
+	std::vector<stk::units::time> ts = { 0.0 * si::seconds, 1.0 * si::seconds, 2.0 * si::seconds };
+	std::vector<stk::units::length> ds = { 0.0 * si::meters, 10.0 * si::meters, 15.0 * si::meters };
+	stk::linear_data_interpolator<stk::units::time, stk::units::length> f(ts, ds);
+	EXPECT_TRUE(f.is_uniform());
+	EXPECT_DOUBLE_EQ(5.0, f(0.5 * si::seconds).value());
+	EXPECT_DOUBLE_EQ(12.5, f(1.5 * si::seconds).value());
+	EXPECT_DOUBLE_EQ(20.0, f(3.0 * si::seconds).value());
+}
+
+TEST(dual_test_suite, gradient_matches_analytic_derivatives)
+{
+	using D = stk::dual<double, 2>;
+	auto x = D::variable(1.5, 0);
+	auto y = D::variable(0.5, 1);
+	auto f = x * y + sin(x) * exp(y) - log(x) / y + sqrt(x) + pow(y, 3) + pow(x, 2.5);
+
+	EXPECT_NEAR(0.5 * 1.5 + std::sin(1.5) * std::exp(0.5) - std::log(1.5) / 0.5 + std::sqrt(1.5) + std::pow(0.5, 3) + std::pow(1.5, 2.5), f.value(), 1e-12);
+	EXPECT_NEAR(0.5 + std::cos(1.5) * std::exp(0.5) - (1.0 / 1.5) / 0.5 + 0.5 / std::sqrt(1.5) + 2.5 * std::pow(1.5, 1.5), f.derivative(0), 1e-12);
+	EXPECT_NEAR(1.5 + std::sin(1.5) * std::exp(0.5) + std::log(1.5) / 0.25 + 3.0 * 0.25, f.derivative(1), 1e-12);
+}
+
+TEST(dual_test_suite, gradient_with_units)
+{
+	using namespace boost::units;
+	using length_dual = stk::dual<stk::units::length, 1>;
+	auto x = length_dual::variable(2.0 * si::meters, 0);
+	auto t = stk::dual<stk::units::time, 1>(4.0 * si::seconds);
+
+	//! d(x^2/t)/dx = 2x/t per unit of the parameter.
+	auto v = x * x / t;
+	EXPECT_NEAR(1.0, v.derivative(0).value(), 1e-12);
+	EXPECT_NEAR(1.0, sqrt(x * x).derivative(0).value(), 1e-12);
+	EXPECT_NEAR(std::exp(2.0), exp(x / length_dual(1.0 * si::meters)).derivative(0).value(), 1e-9);
+}
+
+TEST(dual_test_suite, gradient_descent_on_rosenbrock)
+{
+	using namespace geometrix;
+	auto cost = [](const auto& theta)
+	{
+		auto a = 1.0 - theta[0];
+		auto b = theta[1] - theta[0] * theta[0];
+		return a * a + 100.0 * b * b;
+	};
+
+	auto g = stk::evaluate_gradient<2>(cost, vector<double, 2>{ -1.0, 2.0 });
+	EXPECT_NEAR(104.0, g.first, 1e-12);
+	EXPECT_NEAR(-2.0 * 2.0 - 400.0 * -1.0 * 1.0, g.second[0], 1e-12);
+	EXPECT_NEAR(200.0 * 1.0, g.second[1], 1e-12);
+
+	auto theta = stk::runtime_gradient_descent<2>(vector<double, 2>{ 0.5, 0.5 }, 20000, cost, 0.1, 0.001, 0.0);
+	EXPECT_NEAR(1.0, theta[0], 1e-3);
+	EXPECT_NEAR(1.0, theta[1], 1e-3);
+}
+
+TEST(choice_model_test_suite, exp_batch_matches_std_exp)
+{
+	std::vector<double> xs, out(2001);
+	for (auto i = -1000; i <= 1000; ++i)
+		xs.push_back(0.7 * i);
+	stk::exp_batch(xs, out);
+	for (std::size_t i = 0; i < xs.size(); ++i)
+	{
+		if (xs[i] >= -708.0 && xs[i] <= 709.0)
+			EXPECT_NEAR(1.0, out[i] / std::exp(xs[i]), 1e-14);
+		EXPECT_TRUE(std::isfinite(out[i]) && out[i] > 0.0);
+	}
+}
+
+namespace {
+	struct linear_utility
+	{
+		stk::units::dimensionless operator()(double x) const { return (0.5 - 2.0 * x) * boost::units::si::dimensionless(); }
+		double operator()(std::size_t k, double x) const { return static_cast<double>(k) * x - 0.1 * static_cast<double>(k * k); }
+	};
+}
+
+TEST(choice_model_test_suite, binary_logit_batch_matches_scalar)
+{
+	stk::binary_logit_model<linear_utility> model;
+	std::mt19937 gen(13);
+	std::uniform_real_distribution<double> U(-5.0, 5.0), U01;
+	std::size_t n = 10000;
+	std::vector<double> xs(n), u(n), p(n), uniforms(n);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		xs[i] = U(gen);
+		uniforms[i] = U01(gen);
+	}
+
+	model.utilities(u, xs);
+	model.probabilities(u, p);
+	std::vector<std::uint8_t> choices(n);
+	auto count = model.choose(u, uniforms, choices);
+
+	std::size_t expected = 0;
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		auto pi = model(xs[i]).value();
+		EXPECT_NEAR(pi, p[i], 1e-14);
+		EXPECT_EQ(uniforms[i] < pi, choices[i] == 1);
+		expected += choices[i];
+	}
+	EXPECT_EQ(expected, count);
+}
+
+TEST(choice_model_test_suite, multinomial_logit_is_stable_and_batch_matches_scalar)
+{
+	auto model = stk::make_multinomial_logit_model(linear_utility(), 4);
+
+	//! Utilities of several hundred would overflow a naive exp.
+	auto total = 0.0;
+	for (std::size_t k = 0; k < 4; ++k)
+		total += model(k, 400.0).value();
+	EXPECT_NEAR(1.0, total, 1e-12);
+	EXPECT_NEAR(1.0, model(3, 400.0).value(), 1e-12);
+
+	std::mt19937 gen(13);
+	std::uniform_real_distribution<double> U(-3.0, 3.0), U01;
+	std::size_t n = 1000;
+	std::vector<double> xs(n), uniforms(n), u(4 * n), p(4 * n);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		xs[i] = U(gen);
+		uniforms[i] = U01(gen);
+	}
+
+	model.utilities(n, u, xs);
+	model.probabilities(u, n, p);
+	std::vector<std::uint32_t> choices(n);
+	model.choose(u, uniforms, choices);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		for (std::size_t k = 0; k < 4; ++k)
+			EXPECT_NEAR(model(k, xs[i]).value(), p[k * n + i], 1e-12);
+		EXPECT_EQ(model.choose(uniforms[i], xs[i]), choices[i]);
+	}
+}
+
+TEST(choice_model_test_suite, multinomial_logit_choice_frequencies)
+{
+	auto model = stk::make_multinomial_logit_model(linear_utility(), 3);
+	std::size_t n = 200000;
+	std::mt19937 gen(7);
+	std::uniform_real_distribution<double> U01;
+	std::vector<double> u(3 * n), uniforms(n);
+	for (std::size_t i = 0; i < n; ++i)
+		uniforms[i] = U01(gen);
+	model.utilities(n, u, std::vector<double>(n, 1.0));
+
+	std::vector<std::uint32_t> choices(n);
+	{
+		GEOMETRIX_MEASURE_SCOPE_TIME("multinomial_logit_model batch choose");
+		model.choose(u, uniforms, choices);
+	}
+
+	std::vector<double> frequency(3, 0.0);
+	for (auto c : choices)
+		frequency[c] += 1.0 / n;
+	for (std::size_t k = 0; k < 3; ++k)
+		EXPECT_NEAR(model(k, 1.0).value(), frequency[k], 0.005);
+}
@@ -14,6 +14,7 @@
 #include "pool_work_stealing.hpp"
 #include <boost/context/stack_traits.hpp>
 #include <geometrix/utility/scope_timer.ipp>
+#include <stk/utility/benchmark.hpp>
 
 #include <thread>
 #include <chrono>
@@ -70,6 +71,7 @@ TEST(timing, boost_fibers_skynet_raw)
 	std::uint64_t r;
 	{
 		GEOMETRIX_MEASURE_SCOPE_TIME("boost_fibers_skynet_raw");
+		stk::benchmark_scope bench("boost_fibers_skynet_raw", 1000000);
 		auto f = fts.async([&salloc]() 
 		{
 			return skynet(salloc, 0, 1000000, 10);			
@@ -0,0 +1,85 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <stk/sim/system_scheduler.hpp>
+#include <stk/thread/work_stealing_thread_pool.hpp>
+#include <stk/thread/concurrentqueue.h>
+#include <stk/thread/concurrentqueue_queue_info_no_tokens.h>
+#include <entt/entity/registry.hpp>
+#include <atomic>
+
+using mc_queue_traits = moodycamel_concurrent_queue_traits_no_tokens;
+
+namespace {
+	struct position { double x{ 0 }; };
+	struct velocity { double v{ 0 }; };
+	struct health { int hp{ 100 }; };
+	struct score { double total{ 0 }; };
+}
+
+TEST(system_scheduler_test_suite, conflicting_systems_are_staged_in_order)
+{
+	using pool_t = stk::thread::work_stealing_thread_pool<mc_queue_traits>;
+	using namespace stk;
+	entt::registry registry;
+	pool_t pool;
+
+	std::size_t n = 10000;
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		auto e = registry.create();
+		registry.emplace<position>(e);
+		registry.emplace<velocity>(e, velocity{ static_cast<double>(i % 10) });
+		registry.emplace<health>(e);
+	}
+
+	std::atomic<std::size_t> sumCount{ 0 };
+	double positionSum = 0;
+	system_scheduler<entt::registry, pool_t> scheduler;
+	auto integrate = scheduler.add_system("integrate", reads<velocity>(), writes<position>(), [](entt::registry& r, pool_t& p)
+	{
+		parallel_each<position, velocity>(r, p, [](entt::entity, position& x, velocity& v) { x.x += v.v; }, 256);
+	});
+	auto damage = scheduler.add_system("damage", writes<health>(), [](entt::registry& r, pool_t& p)
+	{
+		parallel_each<health>(r, p, [](entt::entity, health& h) { h.hp -= 1; });
+	});
+	auto sum = scheduler.add_system("sum", reads<position>(), writes<>(), [&](entt::registry& r, pool_t&)
+	{
+		positionSum = 0;
+		for (auto e : r.view<position>())
+			positionSum += r.get<position>(e).x;
+		++sumCount;
+	});
+
+	EXPECT_FALSE(scheduler.conflicts(integrate, damage));
+	EXPECT_TRUE(scheduler.conflicts(integrate, sum));
+	EXPECT_FALSE(scheduler.conflicts(damage, sum));
+	EXPECT_THAT(scheduler.get_stages(), ::testing::ElementsAre(::testing::ElementsAre(integrate, damage), ::testing::ElementsAre(sum)));
+
+	for (auto step = 1; step <= 10; ++step)
+	{
+		scheduler.run(registry, pool);
+		EXPECT_DOUBLE_EQ(step * 4.5 * n, positionSum);
+	}
+
+	for (auto e : registry.view<health>())
+		EXPECT_EQ(90, registry.get<health>(e).hp);
+
+	EXPECT_EQ(10, sumCount.load());
+	for (const auto& s : scheduler.get_statistics())
+	{
+		EXPECT_EQ(10, s.calls);
+		EXPECT_LE(s.max_seconds, s.total_seconds);
+	}
+	EXPECT_EQ(1, scheduler.get_statistics()[sum].stage);
+}
@@ -14,6 +14,7 @@
 #include <random>
 #include <chrono>
 #include <geometrix/utility/scope_timer.ipp>
+#include <stk/utility/benchmark.hpp>
 
 auto nTimingRuns = 200000UL;
 auto numberToInsert = 30UL;
@@ -91,6 +92,7 @@ TEST(timing, std_unordered_set_pointers_insert)
     auto name = std::stringstream{};
     name << "insert " << numberToInsert << " items to std::unordered_set<std::uint64_t>";
 
+    stk::benchmark_scope bench(name.str(), nTimingRuns * numberToInsert);//! includes generating the items.
     for (auto q = 0UL; q < nTimingRuns; ++q)
     {
         auto c = std::unordered_set<std::uint64_t*>{};
@@ -108,6 +110,7 @@ TEST(timing, std_unordered_set_pointers_erase)
     auto name = std::stringstream{};
     name << "erase " << numberToInsert << " items from std::unordered_set<std::uint64_t>";
 
+    stk::benchmark_scope bench(name.str(), nTimingRuns * numberToInsert);//! includes generating the items.
     for (auto q = 0UL; q < nTimingRuns; ++q)
     {
         auto c = std::unordered_set<std::uint64_t*>{};
@@ -127,6 +130,7 @@ TEST(timing, std_set_pointers_insert)
     auto name = std::stringstream{};
     name << "insert " << numberToInsert << " items to std::set<std::uint64_t>";
 
+    stk::benchmark_scope bench(name.str(), nTimingRuns * numberToInsert);//! includes generating the items.
     for (auto q = 0UL; q < nTimingRuns; ++q)
     {
         auto c = std::set<std::uint64_t*>{};
@@ -145,6 +149,7 @@ TEST(timing, std_set_pointers_erase)
     auto name = std::stringstream{};
     name << "erase " << numberToInsert << " items from std::set<std::uint64_t>";
 
+    stk::benchmark_scope bench(name.str(), nTimingRuns * numberToInsert);//! includes generating the items.
     for (auto q = 0UL; q < nTimingRuns; ++q)
     {
         auto c = std::set<std::uint64_t*>{};
@@ -157,3 +162,61 @@ TEST(timing, std_set_pointers_erase)
         run_timing_erase(c, toErase, name.str().c_str());
     }
 }
+
+TEST(timing, benchmark_reports_counters_when_available)
+{
+    std::uint64_t sum = 0;
+    auto r = stk::run_benchmark("sum", 1000000, [&sum]()
+    {
+        for (std::uint64_t i = 0; i < 1000000; ++i)
+            sum += i * i;
+    });
+    EXPECT_NE(0, sum);
+    EXPECT_GT(r.seconds, 0.0);
+
+    //! Counters may be unavailable (e.g. perf_event_paranoid or a container) but when they are not they must be sane.
+    stk::perf_counters counters;
+    if (counters.is_available(stk::perf_event::instructions))
+    {
+        EXPECT_TRUE(r.counters.is_available(stk::perf_event::instructions));
+        EXPECT_GT(r.counters[stk::perf_event::instructions], 0.0);
+    }
+    std::cout << r << std::endl;
+}
+
+TEST(timing, benchmark_statistics_are_robust)
+{
+    auto s = stk::get_statistics({ 10.0, 12.0, 11.0, 1000.0, 9.0 });
+    EXPECT_EQ(11.0, s.median);
+    EXPECT_EQ(1.0, s.mad);
+    EXPECT_EQ(9.0, s.min);
+    EXPECT_EQ(1000.0, s.max);
+    EXPECT_DOUBLE_EQ(9.4, s.p10);
+
+    std::size_t calls = 0;
+    stk::benchmark_options options;
+    options.warmup = 2;
+    options.repetitions = 5;
+    auto r = stk::run_benchmark("count", 10, [&calls]() { ++calls; }, options);
+    EXPECT_EQ(7, calls);
+    EXPECT_EQ(5, r.samples.size());
+    EXPECT_EQ(5, r.repetitions);
+}
+
+TEST(timing, benchmark_comparison_ignores_noise)
+{
+    stk::benchmark_statistics baseline;
+    baseline.median = 100.0;
+    baseline.mad = 1.0;
+    auto current = baseline;
+
+    current.median = 103.0;//! within the threshold.
+    EXPECT_EQ(stk::benchmark_verdict::unchanged, stk::compare_benchmark(baseline, current));
+    current.median = 110.0;
+    EXPECT_EQ(stk::benchmark_verdict::regressed, stk::compare_benchmark(baseline, current));
+    current.mad = 5.0;//! within the noise.
+    EXPECT_EQ(stk::benchmark_verdict::unchanged, stk::compare_benchmark(baseline, current));
+    current.median = 80.0;
+    current.mad = 1.0;
+    EXPECT_EQ(stk::benchmark_verdict::improved, stk::compare_benchmark(baseline, current));
+}
@@ -0,0 +1,160 @@
+//
+//! Copyright © 2026
+//! Brandon Kohn
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <stk/utility/trace.hpp>
+#include <stk/thread/work_stealing_thread_pool.hpp>
+#include <stk/thread/concurrentqueue.h>
+#include <stk/thread/concurrentqueue_queue_info_no_tokens.h>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using mc_queue_traits = moodycamel_concurrent_queue_traits_no_tokens;
+
+namespace {
+	struct recording_writer : stk::trace::trace_writer
+	{
+		recording_writer(std::vector<std::pair<std::string, std::uint32_t>>& events)
+			: events(events)
+		{}
+
+		void write(const stk::trace::event& e, std::uint32_t threadIndex) override
+		{
+			EXPECT_LE(e.begin, e.end);
+			events.emplace_back(e.name, threadIndex);
+		}
+
+		void finish() override {}
+
+		std::vector<std::pair<std::string, std::uint32_t>>& events;
+	};
+}
+
+TEST(trace_test_suite, scopes_are_recorded_per_thread)
+{
+	auto& c = stk::trace::collector::instance();
+	c.flush();
+	std::vector<std::pair<std::string, std::uint32_t>> events;
+	c.start(std::make_unique<recording_writer>(events));
+	{
+		stk::trace::scope outer("outer");
+		stk::trace::scope inner("inner");
+	}
+	std::thread t([]() { stk::trace::scope other("other"); });
+	t.join();
+	c.stop();
+
+	ASSERT_EQ(3u, events.size());
+	std::map<std::string, std::uint32_t> threads;
+	for (const auto& e : events)
+		threads[e.first] = e.second;
+	EXPECT_EQ(threads["outer"], threads["inner"]);
+	EXPECT_NE(threads["outer"], threads["other"]);
+}
+
+TEST(trace_test_suite, full_ring_drops_events)
+{
+	stk::trace::event_ring ring(0);
+	for (std::size_t i = 0; i < stk::trace::event_ring::capacity + 10; ++i)
+		ring.push(stk::trace::event{ "e", i, i + 1 });
+	EXPECT_EQ(10u, ring.get_dropped());
+	EXPECT_EQ(stk::trace::event_ring::capacity, ring.drain([](const stk::trace::event&) {}));
+	ring.push(stk::trace::event{ "e", 0, 1 });
+	EXPECT_EQ(1u, ring.drain([](const stk::trace::event&) {}));
+}
+
+TEST(trace_test_suite, chrome_trace_json)
+{
+	std::ostringstream os;
+	{
+		stk::trace::chrome_trace_writer w(os, 100);
+		w.write(stk::trace::event{ "a \"quoted\" zone", 100, 200 }, 3);
+		w.write(stk::trace::event{ "b", 150, 160 }, 4);
+		w.finish();
+	}
+	auto json = os.str();
+	EXPECT_EQ(0u, json.find("{\"traceEvents\":["));
+	EXPECT_NE(std::string::npos, json.find("\"name\":\"a \\\"quoted\\\" zone\",\"ph\":\"X\",\"pid\":1,\"tid\":3,\"ts\":0.000,"));
+	EXPECT_NE(std::string::npos, json.find("\"tid\":4"));
+	EXPECT_EQ(json.size() - 1, json.rfind('}') + 1);
+}
+
+TEST(trace_test_suite, chrome_trace_keeps_resolution_far_from_origin)
+{
+	//! Two zones 3us apart 30s into the trace.
+	auto ticksPerUs = stk::trace::ticks_per_microsecond();
+	auto at = [ticksPerUs](double us) { return static_cast<std::uint64_t>(std::llround(us * ticksPerUs)); };
+	std::ostringstream os;
+	{
+		stk::trace::chrome_trace_writer w(os, 0);
+		w.write(stk::trace::event{ "a", at(30e6), at(30e6 + 1) }, 0);
+		w.write(stk::trace::event{ "b", at(30e6 + 3), at(30e6 + 4) }, 0);
+		w.finish();
+	}
+	auto json = os.str();
+	EXPECT_EQ(std::string::npos, json.find("e+"));
+	std::vector<double> ts;
+	for (auto i = json.find("\"ts\":"); i != std::string::npos; i = json.find("\"ts\":", i + 1))
+		ts.push_back(std::strtod(json.c_str() + i + 5, nullptr));
+	ASSERT_EQ(2u, ts.size());
+	EXPECT_NEAR(30e6, ts[0], 1e-3);
+	EXPECT_NEAR(3.0, ts[1] - ts[0], 1e-3);
+}
+
+TEST(trace_test_suite, binary_trace_interns_names)
+{
+	std::ostringstream os;
+	{
+		stk::trace::binary_trace_writer w(os, 0);
+		const char* name = "zone";
+		w.write(stk::trace::event{ name, 1, 2 }, 0);
+		w.write(stk::trace::event{ name, 3, 4 }, 1);
+		w.finish();
+	}
+	auto bytes = os.str();
+	auto header = 8 + sizeof(double) + sizeof(std::uint64_t);
+	auto nameRecord = 1 + 2 * sizeof(std::uint32_t) + 4;
+	auto eventRecord = 1 + 2 * sizeof(std::uint32_t) + 2 * sizeof(std::uint64_t);
+	EXPECT_EQ(0, std::memcmp(bytes.data(), "STKTRACE", 8));
+	ASSERT_EQ(header + nameRecord + 2 * eventRecord, bytes.size());
+	EXPECT_EQ('N', bytes[header]);
+	EXPECT_EQ('E', bytes[header + nameRecord]);
+	EXPECT_EQ('E', bytes[header + nameRecord + eventRecord]);
+}
+
+//! The pool's zones are only compiled in when the project is configured with STK_ENABLE_TRACING.
+#ifdef STK_ENABLE_TRACING
+TEST(trace_test_suite, pool_tasks_are_traced)
+{
+	auto& c = stk::trace::collector::instance();
+	std::vector<std::pair<std::string, std::uint32_t>> events;
+	{
+		stk::thread::work_stealing_thread_pool<mc_queue_traits> pool;
+		c.flush();
+		c.start(std::make_unique<recording_writer>(events));
+		pool.parallel_apply(64, [](std::ptrdiff_t) { std::this_thread::sleep_for(std::chrono::microseconds(100)); });
+	}
+	c.stop();
+
+	std::set<std::uint32_t> threads;
+	for (const auto& e : events)
+		if (e.first == "work_stealing_thread_pool::task")
+			threads.insert(e.second);
+	EXPECT_FALSE(threads.empty());
+}
+#endif
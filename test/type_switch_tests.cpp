@@ -11,6 +11,7 @@
 #include "gmock/gmock.h"
 
 #include <stk/utility/type_switch.hpp>
+#include <stk/utility/dense_type_id.hpp>
 #include <iostream>
 #include <array>
 
@@ -25,6 +26,20 @@ struct d1_type : base1_type {};
 struct d2_type : base1_type {};
 struct d3_type : base2_type {};
 struct d4_type : base2_type {};
+
+//! The same hierarchy registering dense type ids (by CRTP and by macro.)
+struct dense_base_type : stk::dense_type_id_base<dense_base_type> {};
+struct dense_base1_type : stk::dense_type_id_base<dense_base1_type, dense_base_type> {};
+struct dense_base2_type : stk::dense_type_id_base<dense_base2_type, dense_base_type> {};
+struct dense_d1_type : stk::dense_type_id_base<dense_d1_type, dense_base1_type> {};
+struct dense_d2_type : dense_base1_type
+{
+    STK_DENSE_TYPE_ID(dense_d2_type)
+};
+struct dense_d3_type : stk::dense_type_id_base<dense_d3_type, dense_base2_type> {};
+struct dense_d4_type : stk::dense_type_id_base<dense_d4_type, dense_base2_type> {};
+//! Not registered so it reports the id of dense_d1_type.
+struct dense_d5_type : dense_d1_type {};
 TEST(memoization_device_suite, test)
 {
     using namespace stk;
@@ -117,6 +132,54 @@ TEST(memoization_device_suite, return_test)
     EXPECT_EQ(1, count[3]);
 }
 
+TEST(memoization_device_suite, dense_type_ids_are_distinct)
+{
+    using namespace stk;
+    auto d1 = dense_d1_type{};
+    auto d2 = dense_d2_type{};
+    auto d5 = dense_d5_type{};
+    const dense_base_type* b1 = &d1;
+    const dense_base_type* b2 = &d2;
+    const dense_base_type* b5 = &d5;
+
+    EXPECT_TRUE(has_dense_type_id<dense_base_type>::value);
+    EXPECT_FALSE(has_dense_type_id<base_type>::value);
+    EXPECT_EQ(dense_type_id<dense_d1_type>(), b1->get_dense_type_id());
+    EXPECT_EQ(dense_type_id<dense_d2_type>(), b2->get_dense_type_id());
+    EXPECT_EQ(dense_type_id<dense_d1_type>(), b5->get_dense_type_id());
+    EXPECT_NE(b1->get_dense_type_id(), b2->get_dense_type_id());
+    EXPECT_LT(b2->get_dense_type_id(), max_dense_type_ids);
+    EXPECT_EQ(&typeid(dense_d2_type), get_dense_type_info(b2->get_dense_type_id()));
+}
+
+TEST(memoization_device_suite, dense_type_id_test)
+{
+    using namespace stk;
+    auto t1 = dense_d1_type{};
+    auto t2 = dense_d2_type{};
+    auto t3 = dense_d3_type{};
+    auto t5 = dense_d5_type{};
+    auto b1 = dense_base1_type{};
+    auto sw = make_switch(
+        type_case([&](dense_d5_type*) { return 5; })
+      , type_case([&](dense_d1_type*) { return 1; })
+      , type_case([&](dense_d2_type*) { return 2; })
+      , type_case([&](dense_base1_type*) { return 0; })
+      , type_default([&](dense_base_type*) { return -1; })
+    );
+
+    //! Twice to dispatch both when resolving and from the cache.
+    for (auto i = 0; i < 2; ++i)
+    {
+        EXPECT_EQ(1, sw((dense_base_type*)&t1));
+        EXPECT_EQ(2, sw((dense_base_type*)&t2));
+        EXPECT_EQ(-1, sw((dense_base_type*)&t3));
+        EXPECT_EQ(5, sw((dense_base_type*)&t5));
+        EXPECT_EQ(0, sw((dense_base_type*)&b1));
+    }
+    sw.clear_cache();
+}
+
 #include <geometrix/utility/scope_timer.ipp>
 auto nruns = 10000000UL;
 TEST(memoization_device_suite, type_switch_timing)
@@ -159,6 +222,46 @@ TEST(memoization_device_suite, type_switch_timing)
     sw.clear_cache();
 }
 
+TEST(memoization_device_suite, dense_type_id_type_switch_timing)
+{
+    using namespace stk;
+    auto t1 = dense_d1_type{};
+    auto t2 = dense_d2_type{};
+    auto t3 = dense_d3_type{};
+    auto t4 = dense_d4_type{};
+    auto sw = make_switch(
+        type_case([&](const dense_d1_type* p)
+        {
+            EXPECT_EQ(&t1, p);
+        })
+      , type_case([&](dense_d2_type* p)
+        {
+            EXPECT_EQ(&t2, p);
+        })
+      , type_case([&](dense_d3_type* p)
+        {
+            EXPECT_EQ(&t3, p);
+        })
+      , type_case([&](dense_d4_type* p)
+        {
+            EXPECT_EQ(&t4, p);
+        })
+    );
+
+    {
+        GEOMETRIX_MEASURE_SCOPE_TIME("type_switch_dense_type_id");
+        for(auto i = 0UL; i < nruns; ++i)
+        {
+            sw((dense_base_type*)&t1);
+            sw((dense_base_type*)&t2);
+            sw((dense_base_type*)&t3);
+            sw((dense_base_type*)&t2);
+            sw((dense_base_type*)&t4);
+        }
+    }
+    sw.clear_cache();
+}
+
 TEST(memoization_device_suite, dynamic_cast_timing)
 {
     using namespace stk;